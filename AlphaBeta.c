@@ -0,0 +1,442 @@
+// AlphaBeta.c ... minimax search with alpha-beta pruning for Dracula
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "Game.h"
+#include "Places.h"
+#include "Map.h"
+#include "GameState.h"
+#include "DracView.h"
+#include "TransTable.h"
+#include "TimeBudget.h"
+#include "AlphaBeta.h"
+
+#define INFINITY_VALUE   1000000
+#define MAX_PLY          64
+#define CHECK_EVERY      1024     // positions between looks at the clock
+#define ASPIRATION       60       // half width of the first window tried
+
+// what a position is worth to Dracula, per point of each
+#define HEALTH_WEIGHT        10   // his blood
+#define SCORE_WEIGHT         8    // score lost
+#define DISTANCE_WEIGHT      6    // move between him and a hunter...
+#define FAR                  4    // ...counting this many at most
+#define HUNTER_HEALTH_WEIGHT 2    // hunters' health
+#define VAMPIRE_WEIGHT       50   // immature vampire on the trail
+#define STEALTH_WEIGHT       8    // bit of the hunters' doubt where he is,
+                                  // after his next move
+
+// ordering scores
+#define ORDER_TT_MOVE    (1 << 30)
+#define ORDER_KILLER     (1 << 20)
+
+struct alphaBeta {
+    TransTable table;
+    TimeBudget budget;
+    long       nodes;
+    int        stopped;
+    int        depth;          // deepest ply completed
+    int        value;          // and what it was worth
+    LocationID move;           // and the best move it found
+    LocationID iterationMove;  // the best move of the ply being searched
+    LocationID killers[MAX_PLY][2];
+    int        maxDepth;       // deepest ply to search
+    int        bonus[TELEPORT+1];  // added to each first move's value
+};
+
+// moves by road or sea between every pair of places
+static uint8_t distances[NUM_MAP_LOCATIONS][NUM_MAP_LOCATIONS];
+static pthread_once_t distancesMade = PTHREAD_ONCE_INIT;
+
+static void makeDistances(void);
+static LocationID deepen(AlphaBeta search, const GameState *state);
+static int doubtBits(int numPlaces);
+static int alphaBeta(AlphaBeta search, GameState *state, int depth, int ply,
+                     int alpha, int beta);
+static int evaluate(const GameState *state);
+static int distanceBetween(LocationID from, LocationID to);
+static void orderMoves(AlphaBeta search, const GameState *state, int ply,
+                       LocationID ttMove, LocationID moves[], int numMoves);
+static int toTable(int value, int ply);
+static int fromTable(int value, int ply);
+static void registerMove(LocationID move);
+
+AlphaBeta newAlphaBeta(int log2Entries)
+{
+    pthread_once(&distancesMade, makeDistances);
+    AlphaBeta search = malloc(sizeof(struct alphaBeta));
+    assert(search != NULL);
+    search->table = newTransTable(log2Entries);
+    search->nodes = 0;
+    search->depth = 0;
+    search->value = 0;
+    search->move = NOWHERE;
+    search->maxDepth = MAX_PLY-1;
+    return search;
+}
+
+void disposeAlphaBeta(AlphaBeta toBeDeleted)
+{
+    disposeTransTable(toBeDeleted->table);
+    free(toBeDeleted);
+}
+
+// searches for Dracula's best move, each first move worth more for how
+// many places the hunters could then think he is
+LocationID abDraculaMove(AlphaBeta search, DracView view, int msecs)
+{
+    budgetStart(&search->budget, msecs);
+    GameState state;
+    giveMeTheState(view, &state);
+    LocationID moves[MAX_MOVES];
+    int stealth[TELEPORT+1] = {0};
+    int i, numMoves = legalMoves(&state, moves);
+    for (i = 0; i < numMoves; i++){
+        stealth[moves[i]] = STEALTH_WEIGHT*doubtBits(howHiddenAfter(view, moves[i]));
+    }
+    memcpy(search->bonus, stealth, sizeof(stealth));
+    return deepen(search, &state);
+}
+
+LocationID abSearch(AlphaBeta search, const GameState *state, int msecs)
+{
+    budgetStart(&search->budget, msecs);
+    memset(search->bonus, 0, sizeof(search->bonus));
+    return deepen(search, state);
+}
+
+LocationID abSearchBonus(AlphaBeta search, const GameState *state,
+                         const int bonus[TELEPORT+1], int msecs)
+{
+    budgetStart(&search->budget, msecs);
+    memcpy(search->bonus, bonus, sizeof(search->bonus));
+    return deepen(search, state);
+}
+
+void abSetMaxDepth(AlphaBeta search, int maxDepth)
+{
+    search->maxDepth = maxDepth > 0 && maxDepth < MAX_PLY ? maxDepth : MAX_PLY-1;
+}
+
+// searches from a state, deepening a ply at a time
+static LocationID deepen(AlphaBeta search, const GameState *state)
+{
+    assert(state->curr == PLAYER_DRACULA);
+    ttNewSearch(search->table);
+    search->nodes = 0;
+    search->stopped = FALSE;
+    search->depth = 0;
+    search->value = 0;
+    int i;
+    for (i = 0; i < MAX_PLY; i++){
+        search->killers[i][0] = search->killers[i][1] = NOWHERE;
+    }
+
+    //have a move in before anything else
+    LocationID moves[MAX_MOVES];
+    int numMoves = legalMoves(state, moves);
+    assert(numMoves > 0);
+    orderMoves(search, state, 0, NOWHERE, moves, numMoves);
+    search->move = moves[0];
+    registerMove(search->move);
+    if (numMoves == 1){
+        return search->move;
+    }
+
+    GameState root = *state;
+    int depth;
+    //stop before a ply that won't be finished in time
+    for (depth = 1; depth <= search->maxDepth && budgetAllowsNext(&search->budget); depth++){
+        budgetIterationStarted(&search->budget);
+        //look near the last value first, and everywhere if it isn't there
+        int alpha = -INFINITY_VALUE, beta = INFINITY_VALUE;
+        if (depth > 1){
+            alpha = search->value - ASPIRATION;
+            beta = search->value + ASPIRATION;
+        }
+        int value = alphaBeta(search, &root, depth, 0, alpha, beta);
+        if (!search->stopped && (value <= alpha || value >= beta)){
+            value = alphaBeta(search, &root, depth, 0, -INFINITY_VALUE, INFINITY_VALUE);
+        }
+        if (search->stopped){
+            break;
+        }
+        budgetIterationDone(&search->budget);
+        search->depth = depth;
+        search->value = value;
+        if (search->iterationMove != search->move){
+            search->move = search->iterationMove;
+            registerMove(search->move);
+        }
+        //no point looking further than a forced win or loss
+        if (value > AB_WIN - MAX_PLY || value < -AB_WIN + MAX_PLY){
+            break;
+        }
+    }
+    return search->move;
+}
+
+int abDepth(AlphaBeta search)
+{
+    return search->depth;
+}
+
+int abValue(AlphaBeta search)
+{
+    return search->value;
+}
+
+long abNodes(AlphaBeta search)
+{
+    return search->nodes;
+}
+
+// log2 of how many places the hunters could think he is, rounded down
+// (what they don't know, if every place is as likely)
+static int doubtBits(int numPlaces)
+{
+    int bits = 0;
+    while (numPlaces > 1){
+        numPlaces >>= 1;
+        bits ++;
+    }
+    return bits;
+}
+
+// breadth first searches from every place along roads and sea lanes
+static void makeDistances(void)
+{
+    Map map = newMap();
+    LocationID from;
+    for (from = MIN_MAP_LOCATION; from <= MAX_MAP_LOCATION; from++){
+        LocationSet seen = setOf(from);
+        LocationSet frontier = seen;
+        int d = 0;
+        LocationID to;
+        for (to = MIN_MAP_LOCATION; to <= MAX_MAP_LOCATION; to++){
+            distances[from][to] = UINT8_MAX;
+        }
+        while (!setIsEmpty(frontier)){
+            LocationSet next = setEmpty();
+            LocationID places[NUM_MAP_LOCATIONS];
+            int i, numPlaces = setToArray(frontier, places);
+            for (i = 0; i < numPlaces; i++){
+                distances[from][places[i]] = d;
+                next = setUnion(next, connectionSet(map, places[i], ROAD));
+                next = setUnion(next, connectionSet(map, places[i], BOAT));
+            }
+            frontier = setMinus(next, seen);
+            seen = setUnion(seen, frontier);
+            d ++;
+        }
+    }
+}
+
+// the value of the state to Dracula, searching depth plies ahead;
+// Dracula takes the biggest value and the hunters the smallest
+static int alphaBeta(AlphaBeta search, GameState *state, int depth, int ply,
+                     int alpha, int beta)
+{
+    search->nodes ++;
+    if ((search->nodes & (CHECK_EVERY-1)) == 0 && budgetExpired(&search->budget)){
+        search->stopped = TRUE;
+    }
+    if (search->stopped){
+        return 0;
+    }
+    if (state->draculaHealth <= 0){
+        return -AB_WIN + ply;
+    }
+    if (state->score <= 0){
+        return AB_WIN - ply;
+    }
+    if (depth == 0 || ply >= MAX_PLY-1){
+        return evaluate(state);
+    }
+
+    //what an earlier search found here
+    int ttDepth, ttValue, ttBound;
+    LocationID ttMove = NOWHERE;
+    if (ttProbe(search->table, state->hash, &ttDepth, &ttValue, &ttBound, &ttMove)
+        && ttDepth >= depth && ply > 0){
+        ttValue = fromTable(ttValue, ply);
+        if (ttBound == BOUND_EXACT){
+            return ttValue;
+        } else if (ttBound == BOUND_LOWER && ttValue > alpha){
+            alpha = ttValue;
+        } else if (ttBound == BOUND_UPPER && ttValue < beta){
+            beta = ttValue;
+        }
+        if (alpha >= beta){
+            return ttValue;
+        }
+    }
+
+    LocationID moves[MAX_MOVES];
+    int numMoves = legalMoves(state, moves);
+    if (numMoves == 0){
+        return evaluate(state);
+    }
+    orderMoves(search, state, ply, ttMove, moves, numMoves);
+
+    int maximising = state->curr == PLAYER_DRACULA;
+    int alphaWas = alpha, betaWas = beta;
+    int best = maximising ? -INFINITY_VALUE : INFINITY_VALUE;
+    LocationID bestMove = moves[0];
+    int i;
+    for (i = 0; i < numMoves; i++){
+        //a first move's bonus (how well the hunters lose him matters for
+        //longer than the lookahead sees) shifts the window its search
+        //gets, so a bound it returns is still a bound once added to
+        int bonus = ply == 0 && maximising ? search->bonus[moves[i]] : 0;
+        Undo undo;
+        applyMove(state, moves[i], &undo);
+        int value = alphaBeta(search, state, depth-1, ply+1,
+                              alpha - bonus, beta - bonus);
+        undoMove(state, &undo);
+        if (search->stopped){
+            return 0;
+        }
+        if (value < AB_WIN - MAX_PLY && value > -AB_WIN + MAX_PLY){
+            value += bonus;
+        }
+        if (maximising ? value > best : value < best){
+            best = value;
+            bestMove = moves[i];
+        }
+        if (maximising && best > alpha){
+            alpha = best;
+        } else if (!maximising && best < beta){
+            beta = best;
+        }
+        if (alpha >= beta){
+            //remember the move that cut off the search for its neighbours
+            if (search->killers[ply][0] != moves[i]){
+                search->killers[ply][1] = search->killers[ply][0];
+                search->killers[ply][0] = moves[i];
+            }
+            break;
+        }
+    }
+
+    int bound = best <= alphaWas ? BOUND_UPPER :
+                best >= betaWas ? BOUND_LOWER : BOUND_EXACT;
+    ttStore(search->table, state->hash, depth, toTable(best, ply), bound, bestMove);
+    if (ply == 0){
+        search->iterationMove = bestMove;
+    }
+    return best;
+}
+
+// what a position where nobody has won yet is worth to Dracula
+static int evaluate(const GameState *state)
+{
+    int value = HEALTH_WEIGHT*state->draculaHealth - SCORE_WEIGHT*state->score;
+    LocationID dracula = trailWhere(state, 0);
+    int h;
+    for (h = 0; h < NUM_HUNTERS; h++){
+        int d = distanceBetween(state->location[h], dracula);
+        value += DISTANCE_WEIGHT*(d < FAR ? d : FAR);
+        value -= HUNTER_HEALTH_WEIGHT*state->health[h];
+    }
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        if (trailMinions(state, i) & MINION_VAMPIRE){
+            value += VAMPIRE_WEIGHT;
+        }
+    }
+    return value;
+}
+
+// moves between two places, or FAR if either isn't known
+static int distanceBetween(LocationID from, LocationID to)
+{
+    if (!validPlace(from) || !validPlace(to)){
+        return FAR;
+    }
+    return distances[from][to];
+}
+
+// sorts the moves, most promising first
+static void orderMoves(AlphaBeta search, const GameState *state, int ply,
+                       LocationID ttMove, LocationID moves[], int numMoves)
+{
+    int scores[MAX_MOVES];
+    LocationID dracula = trailWhere(state, 0);
+    LocationID trail[TRAIL_SIZE];
+    trailPlaces(state, trail);
+    int i, h;
+    for (i = 0; i < numMoves; i++){
+        LocationID move = moves[i];
+        int score = 0;
+        if (move == ttMove){
+            score = ORDER_TT_MOVE;
+        } else if (move == search->killers[ply][0]){
+            score = ORDER_KILLER;
+        } else if (move == search->killers[ply][1]){
+            score = ORDER_KILLER - 1;
+        } else if (state->curr == PLAYER_DRACULA){
+            //away from the hunters
+            LocationID to = moveDestination(trail, move);
+            for (h = 0; h < NUM_HUNTERS; h++){
+                score += distanceBetween(state->location[h], to);
+            }
+        } else {
+            //towards Dracula
+            score = FAR*FAR - distanceBetween(move, dracula);
+        }
+        scores[i] = score;
+    }
+
+    //insertion sort, as there are never many moves
+    for (i = 1; i < numMoves; i++){
+        int score = scores[i];
+        LocationID move = moves[i];
+        int j;
+        for (j = i; j > 0 && scores[j-1] < score; j--){
+            scores[j] = scores[j-1];
+            moves[j] = moves[j-1];
+        }
+        scores[j] = score;
+        moves[j] = move;
+    }
+}
+
+// wins and losses are stored as plies from the position, not the root
+static int toTable(int value, int ply)
+{
+    if (value > AB_WIN - MAX_PLY) return value + ply;
+    if (value < -AB_WIN + MAX_PLY) return value - ply;
+    return value;
+}
+
+static int fromTable(int value, int ply)
+{
+    if (value > AB_WIN - MAX_PLY) return value - ply;
+    if (value < -AB_WIN + MAX_PLY) return value + ply;
+    return value;
+}
+
+// tells the game engine the move is our best so far, as the two
+// characters of its play
+static void registerMove(LocationID move)
+{
+    PlayerMessage message = "";
+    char code[3];
+    if (move == HIDE){
+        strcpy(code, "HI");
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+        code[0] = 'D';
+        code[1] = '1' + (move - DOUBLE_BACK_1);
+        code[2] = '\0';
+    } else if (move == TELEPORT){
+        strcpy(code, "TP");
+    } else {
+        strcpy(code, idToAbbrev(move));
+    }
+    registerBestPlay(code, message);
+}
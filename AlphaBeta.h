@@ -0,0 +1,74 @@
+// AlphaBeta.h ... minimax search with alpha-beta pruning for Dracula
+//
+// Dracula knows where everyone is, so he can look ahead properly: the
+// search plays out his moves and each hunter's in turn on a GameState
+// (with the full trail rules, as draculaMoves() and hunterMoves()) and
+// takes the hunters to play as well as they could if they could see
+// him too, i.e. as a team against him. At the end of the lookahead a
+// position is scored by Dracula's blood, the score, how near the
+// hunters are and the vampires he has on the way. From a DracView, each
+// of his first moves is also worth more for how many places the hunters
+// could then think he is (see howHiddenAfter() in DracView.h), since
+// how well he loses them matters long after the lookahead ends.
+//
+// The search deepens a ply at a time until its time is up, or until
+// the next ply looks like it won't finish in time (see TimeBudget.h),
+// starting
+// each ply with a narrow window round the last value and widening it
+// only if the value falls outside. Moves are tried best first: the
+// move a transposition table remembers for the position, then moves
+// that cut the search off at the same depth before, then hunters
+// closing in on him (or him getting away). After each completed ply
+// the best move is registered with registerBestPlay() if it has
+// changed, and one is registered as soon as the search starts, so
+// there is always a move registered whenever it is stopped.
+
+#ifndef ALPHA_BETA_H
+#define ALPHA_BETA_H
+
+#include "Globals.h"
+#include "Places.h"
+#include "GameState.h"
+#include "DracView.h"
+
+// the value of a forced win for Dracula, less the plies it takes
+// (a forced loss is the negative)
+#define AB_WIN   100000
+
+typedef struct alphaBeta *AlphaBeta;
+
+// a search with a transposition table of 2^log2Entries entries (kept
+// between searches)
+
+AlphaBeta newAlphaBeta(int log2Entries);
+void disposeAlphaBeta(AlphaBeta toBeDeleted);
+
+// searches for Dracula's best move for msecs milliseconds (timed from
+// the call), registering it as it changes, and returns it
+
+LocationID abDraculaMove(AlphaBeta search, DracView view, int msecs);
+
+// the same, from a state (e.g. from giveMeTheState()), without what
+// the hunters know; the current player must be Dracula
+
+LocationID abSearch(AlphaBeta search, const GameState *state, int msecs);
+
+// the same, with bonus[move] added to the value of each of Dracula's
+// first moves (as abDraculaMove() does for how hidden each leaves him)
+
+LocationID abSearchBonus(AlphaBeta search, const GameState *state,
+                         const int bonus[TELEPORT+1], int msecs);
+
+// searches no deeper than maxDepth plies from now on (0 for as deep as
+// there is time for)
+
+void abSetMaxDepth(AlphaBeta search, int maxDepth);
+
+// the deepest search the last search completed (in plies), its value
+// for Dracula, and how many positions it searched
+
+int abDepth(AlphaBeta search);
+int abValue(AlphaBeta search);
+long abNodes(AlphaBeta search);
+
+#endif
@@ -0,0 +1,281 @@
+// Belief.c ... where the hunters know Dracula could be
+
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "Places.h"
+#include "Map.h"
+#include "LocationSet.h"
+#include "Plays.h"
+#include "Belief.h"
+
+#define SET_BYTES   ((NUM_MAP_LOCATIONS + 7) / 8)
+
+// everywhere Dracula can get to from any of the places in each byte of
+// a set, for every value of the byte
+static LocationSet reachByte[SET_BYTES][256];
+static LocationSet reach[NUM_MAP_LOCATIONS];   // from each place
+static LocationSet anywhere;   // everywhere but the hospital
+static LocationSet cities;     // where a C? can take him
+static LocationSet seas;
+static pthread_once_t tablesMade = PTHREAD_ONCE_INIT;
+
+static void makeTables(void);
+static LocationSet forward(const Belief *belief, int i);
+static void narrow(Belief *belief);
+static void narrowSlot(Belief *belief, int i, LocationSet fits);
+static LocationSet trailPlaces(const Belief *belief, int after);
+static void visitPlay(void *belief, const Play *play);
+
+void initBelief(Belief *belief)
+{
+    pthread_once(&tablesMade, makeTables);
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        belief->where[i] = setEmpty();
+        belief->moves[i] = UNKNOWN_LOCATION;
+    }
+}
+
+// updates the belief with plays from a pastPlays string
+void beliefAppend(Belief *belief, char *plays)
+{
+    forEachPlay(plays, visitPlay, belief);
+}
+
+static void visitPlay(void *belief, const Play *play)
+{
+    beliefPlay(belief, play);
+}
+
+// updates the belief with one play
+void beliefPlay(Belief *belief, const Play *play)
+{
+    if (play->player == PLAYER_DRACULA){
+        beliefDraculaMove(belief, play->move);
+    } else if (play->player >= 0 && validPlace(play->move)){
+        int all = (1 << ENCOUNTER_SLOTS) - 1;
+        int dracula = (play->encounters >> (ENCOUNTER_DRACULA*ENCOUNTER_SLOTS)) & all;
+        int traps = (play->encounters >> (ENCOUNTER_TRAP*ENCOUNTER_SLOTS)) & all;
+        int vampires = (play->encounters >> (ENCOUNTER_VAMPIRE*ENCOUNTER_SLOTS)) & all;
+        beliefHunterMove(belief, play->move, dracula != 0, (traps | vampires) != 0);
+    }
+}
+
+// Dracula made move, as the hunters see it
+void beliefDraculaMove(Belief *belief, LocationID move)
+{
+    int i;
+    for (i = TRAIL_SIZE-1; i > 0; i--){
+        belief->where[i] = belief->where[i-1];
+        belief->moves[i] = belief->moves[i-1];
+    }
+    belief->moves[0] = move;
+    belief->where[0] = anywhere;
+    belief->where[0] = forward(belief, 0);
+    //even a hidden move rules out places before it that lead to no
+    //city (or sea), and narrowing every move keeps the belief as narrow
+    //as hunters' moves that tell nothing new would have left it
+    narrow(belief);
+}
+
+// a hunter moved to where and found Dracula there or not
+void beliefHunterMove(Belief *belief, LocationID where,
+                      int foundDracula, int foundMinion)
+{
+    if (belief->moves[0] == UNKNOWN_LOCATION){
+        return;
+    }
+    if (foundDracula){
+        belief->where[0] = setOf(where);
+        narrow(belief);
+    } else if (!foundMinion && idToType(where) != SEA &&
+               setHas(belief->where[0], where)){
+        //a hunter who met no traps on the way in would have met him
+        //(but they never meet him at sea); somewhere he already can't
+        //be tells nothing
+        LocationSet notThere = setOf(where);
+        narrowSlot(belief, 0, setMinus(anywhere, notThere));
+        narrow(belief);
+    }
+    if (foundMinion){
+        //only the trail leaves minions, so if only one move of it could
+        //have been there, it was
+        int slot = -1, i;
+        for (i = 0; i < TRAIL_SIZE; i++){
+            if (setHas(belief->where[i], where)){
+                slot = slot == -1 ? i : TRAIL_SIZE;
+            }
+        }
+        if (slot >= 0 && slot < TRAIL_SIZE && setSize(belief->where[slot]) > 1){
+            belief->where[slot] = setOf(where);
+            narrow(belief);
+        }
+    }
+}
+
+LocationSet beliefWhere(const Belief *belief)
+{
+    return belief->where[0];
+}
+
+LocationSet beliefTrail(const Belief *belief, int movesAgo)
+{
+    return belief->where[movesAgo];
+}
+
+// the sets of the places in each byte of from, joined
+LocationSet draculaReachable(LocationSet from)
+{
+    pthread_once(&tablesMade, makeTables);
+    LocationSet reach = setEmpty();
+    int b;
+    for (b = 0; b < SET_BYTES; b++){
+        int byte = (from.bits[b / 8] >> (8*(b % 8))) & 0xFF;
+        reach = setUnion(reach, reachByte[b][byte]);
+    }
+    return reach;
+}
+
+LocationID hiddenMove(LocationID move)
+{
+    if (!validPlace(move) || move == CASTLE_DRACULA){
+        return move;
+    }
+    return idToType(move) == SEA ? SEA_UNKNOWN : CITY_UNKNOWN;
+}
+
+LocationSet draculaReach(LocationID from)
+{
+    pthread_once(&tablesMade, makeTables);
+    assert(validPlace(from));
+    return reach[from];
+}
+
+LocationSet draculaCities(void)
+{
+    pthread_once(&tablesMade, makeTables);
+    return cities;
+}
+
+LocationSet draculaSeas(void)
+{
+    pthread_once(&tablesMade, makeTables);
+    return seas;
+}
+
+// one place's reach, then each byte value's from a smaller value's
+static void makeTables(void)
+{
+    Map map = newMap();
+    anywhere = setAll();
+    setRemove(&anywhere, ST_JOSEPH_AND_ST_MARYS);
+    cities = setEmpty();
+    seas = setEmpty();
+    LocationID v;
+    for (v = MIN_MAP_LOCATION; v <= MAX_MAP_LOCATION; v++){
+        reach[v] = setUnion(connectionSet(map, v, ROAD), connectionSet(map, v, BOAT));
+        setAdd(&reach[v], v);
+        setRemove(&reach[v], ST_JOSEPH_AND_ST_MARYS);
+        if (idToType(v) == SEA){
+            setAdd(&seas, v);
+        } else if (v != ST_JOSEPH_AND_ST_MARYS && v != CASTLE_DRACULA){
+            //he's always seen at Castle Dracula
+            setAdd(&cities, v);
+        }
+    }
+    int b, byte;
+    for (b = 0; b < SET_BYTES; b++){
+        reachByte[b][0] = setEmpty();
+        for (byte = 1; byte < 256; byte++){
+            v = 8*b + __builtin_ctz(byte);
+            LocationSet rest = reachByte[b][byte & (byte - 1)];
+            reachByte[b][byte] = v < NUM_MAP_LOCATIONS ? setUnion(rest, reach[v]) : rest;
+        }
+    }
+}
+
+// where move i could have taken him, given where the move before it
+// could have (and where move i+n could have, if it doubled back to it)
+static LocationSet forward(const Belief *belief, int i)
+{
+    LocationID move = belief->moves[i];
+    LocationSet from;
+    if (i+1 == TRAIL_SIZE){
+        from = anywhere;            //off the end of what's kept
+    } else if (belief->moves[i+1] == UNKNOWN_LOCATION){
+        from = setEmpty();          //his first move
+    } else {
+        from = belief->where[i+1];
+    }
+    LocationSet to = setIsEmpty(from) ? anywhere : draculaReachable(from);
+
+    if (move == CITY_UNKNOWN){
+        return setMinus(setIntersect(to, cities), trailPlaces(belief, i));
+    } else if (move == SEA_UNKNOWN){
+        return setMinus(setIntersect(to, seas), trailPlaces(belief, i));
+    } else if (move == HIDE){
+        return setIsEmpty(from) ? setMinus(anywhere, seas) : setMinus(from, seas);
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+        int back = i + move - DOUBLE_BACK_1 + 1;
+        return back < TRAIL_SIZE ? setIntersect(to, belief->where[back]) : to;
+    } else if (move == TELEPORT){
+        return setOf(CASTLE_DRACULA);
+    } else if (validPlace(move)){
+        return setOf(move);
+    }
+    return anywhere;
+}
+
+// narrows every move of the trail to fit the moves either side of it:
+// back from the latest, then forward again
+static void narrow(Belief *belief)
+{
+    int i;
+    for (i = 0; i < TRAIL_SIZE-1 && belief->moves[i+1] != UNKNOWN_LOCATION; i++){
+        LocationID move = belief->moves[i];
+        LocationSet here = belief->where[i];
+        if (move == HIDE){
+            narrowSlot(belief, i+1, here);
+        } else if (move != TELEPORT){
+            //roads and sea lanes go both ways
+            narrowSlot(belief, i+1, draculaReachable(here));
+        }
+        if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+            int back = i + move - DOUBLE_BACK_1 + 1;
+            if (back < TRAIL_SIZE){
+                narrowSlot(belief, back, here);
+            }
+        }
+    }
+    for (i = TRAIL_SIZE-1; i >= 0; i--){
+        if (belief->moves[i] != UNKNOWN_LOCATION){
+            narrowSlot(belief, i, forward(belief, i));
+        }
+    }
+}
+
+// keeps only the places in fits, unless none are (which can only be if
+// the plays broke the rules, and then the places are left as they were)
+static void narrowSlot(Belief *belief, int i, LocationSet fits)
+{
+    LocationSet narrowed = setIntersect(belief->where[i], fits);
+    if (!setIsEmpty(narrowed)){
+        belief->where[i] = narrowed;
+    }
+}
+
+// the places known to be on his trail among the TRAIL_SIZE-1 moves
+// before move after, which move after can't have gone to
+static LocationSet trailPlaces(const Belief *belief, int after)
+{
+    LocationSet places = setEmpty();
+    int i;
+    for (i = after+1; i < after+TRAIL_SIZE && i < TRAIL_SIZE; i++){
+        if (setSize(belief->where[i]) == 1){
+            places = setUnion(places, belief->where[i]);
+        }
+    }
+    return places;
+}
@@ -0,0 +1,88 @@
+// Belief.h ... where the hunters know Dracula could be
+//
+// A Belief holds, for each of the last TRAIL_SIZE moves of Dracula's
+// trail, the set of places that move could have taken him, the first
+// being where he could be now. It is kept up to date a play at a time:
+//
+//   - his move spreads the set along the roads and sea lanes he can use
+//     (never rail, never the hospital), then keeps only cities for a C?
+//     or seas for an S?, and leaves out places still on his trail;
+//     HIDE keeps him where he was, DOUBLE_BACK_n puts him where the
+//     move n back was, and a revealed place or TELEPORT pins him down
+//   - a hunter who runs into him pins him down where they are, a
+//     hunter on land who doesn't (and met no traps first) rules out
+//     where they are, and a trap or vampire found means a trail move was there
+//
+// and whenever one move is pinned down the others are narrowed to fit,
+// along the trail both ways. Spreading a set looks up the places each
+// byte of it can reach in a table, so it is nine look-ups whatever is
+// in the set, and an update is a few dozen word operations with no
+// allocation: cheap enough to keep one per position in a search.
+
+#ifndef BELIEF_H
+#define BELIEF_H
+
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "LocationSet.h"
+#include "Plays.h"
+
+typedef struct belief {
+    LocationSet where[TRAIL_SIZE];  // where each move took him, latest first
+    int8_t      moves[TRAIL_SIZE];  // the moves as the hunters saw them
+                                    // (UNKNOWN_LOCATION before his first)
+} Belief;
+
+// nothing known: before Dracula's first move
+
+void initBelief(Belief *belief);
+
+// updates the belief with plays from a pastPlays string (see
+// gameViewAppend() in GameView.h for the format)
+
+void beliefAppend(Belief *belief, char *plays);
+
+// updates the belief with one play, by a hunter or Dracula
+
+void beliefPlay(Belief *belief, const Play *play);
+
+// Dracula made move, as the hunters see it (CITY_UNKNOWN, SEA_UNKNOWN,
+// HIDE, DOUBLE_BACK_n, TELEPORT or a place)
+
+void beliefDraculaMove(Belief *belief, LocationID move);
+
+// a hunter moved to where and found Dracula there or not, and found a
+// trap or vampire there or not
+
+void beliefHunterMove(Belief *belief, LocationID where,
+                      int foundDracula, int foundMinion);
+
+// where Dracula could be now, and where his move movesAgo moves ago
+// (0...TRAIL_SIZE-1) could have taken him
+
+LocationSet beliefWhere(const Belief *belief);
+LocationSet beliefTrail(const Belief *belief, int movesAgo);
+
+// everywhere Dracula could get to in one move from somewhere in from,
+// staying put included
+
+LocationSet draculaReachable(LocationSet from);
+
+// everywhere Dracula can get to in one move from a place, staying put
+// included (never the hospital)
+
+LocationSet draculaReach(LocationID from);
+
+// the places a C? can take him (not Castle Dracula, where he's always
+// seen, or the hospital), and the places an S? can
+
+LocationSet draculaCities(void);
+LocationSet draculaSeas(void);
+
+// Dracula's move as the hunters see it: a place other than Castle
+// Dracula is CITY_UNKNOWN or SEA_UNKNOWN, anything else as it is
+
+LocationID hiddenMove(LocationID move);
+
+#endif
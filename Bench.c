@@ -0,0 +1,126 @@
+// Bench.c ... shared harness for the benchmark programs
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Bench.h"
+#include "GameGen.h"
+
+#define WARMUP_SAMPLES   10
+#define SAMPLES          101
+#define SAMPLE_NSECS     200000L   // aim for samples at least this long
+#define MAX_BATCH        (1 << 20)
+
+volatile long benchSink;
+
+//// allocation counting
+
+static long allocations = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    allocations ++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    allocations ++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    allocations ++;
+    return __real_realloc(ptr, size);
+}
+
+//// timing
+
+static long nowNsecs(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec*1000000000L + t.tv_nsec;
+}
+
+static int compareDoubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// runs ops op(arg, first) ... op(arg, first+ops-1), returns the time taken
+static long timeBatch(BenchOp op, void *arg, int first, int ops)
+{
+    int i;
+    long start = nowNsecs();
+    for (i = 0; i < ops; i++) {
+        op(arg, first + i);
+    }
+    return nowNsecs() - start;
+}
+
+// prints the column headings for runBench()
+void benchHeader(char *title)
+{
+    printf("\n%s\n", title);
+    printf("%-32s %12s %12s %12s %12s %10s\n",
+           "benchmark", "mean ns/op", "p50", "p90", "p99", "allocs/op");
+}
+
+// times op(arg, i) and prints one line of results under name
+void runBench(char *name, BenchOp op, void *arg)
+{
+    double perOp[SAMPLES];
+    int batch = 1, next = 0, s;
+
+    // grow the batch until a sample is long enough to time (this warms up too)
+    while (batch < MAX_BATCH && timeBatch(op, arg, next, batch) < SAMPLE_NSECS) {
+        next += batch;
+        batch *= 2;
+    }
+    for (s = 0; s < WARMUP_SAMPLES; s++, next += batch) {
+        timeBatch(op, arg, next, batch);
+    }
+
+    long allocationsBefore = allocations;
+    double total = 0;
+    for (s = 0; s < SAMPLES; s++, next += batch) {
+        perOp[s] = (double)timeBatch(op, arg, next, batch) / batch;
+        total += perOp[s];
+    }
+    double allocsPerOp = (double)(allocations - allocationsBefore) / ((double)SAMPLES*batch);
+
+    qsort(perOp, SAMPLES, sizeof(double), compareDoubles);
+    printf("%-32s %12.1f %12.1f %12.1f %12.1f %10.2f\n", name, total / SAMPLES,
+           perOp[SAMPLES/2], perOp[SAMPLES*9/10], perOp[SAMPLES*99/100], allocsPerOp);
+}
+
+//// games to benchmark with
+
+// fills plays with the first rounds rounds of a random legal game
+void makeBenchGame(char *plays, int rounds, unsigned int seed)
+{
+    static char game[MAX_GAME_LENGTH+1];
+    GameGen gen = newGameGen(seed);
+    int wanted = rounds*NUM_PLAYERS;
+
+    // most games are over well before BENCH_MAX_ROUNDS, so keep going
+    // until one lasts long enough
+    while (generateGame(gen, game, rounds) < wanted) {
+        ;
+    }
+    disposeGameGen(gen);
+    if (wanted == 0) {
+        plays[0] = '\0';
+    } else {
+        memcpy(plays, game, wanted*PLAY_LENGTH - 1);
+        plays[wanted*PLAY_LENGTH - 1] = '\0';
+    }
+}
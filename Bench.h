@@ -0,0 +1,42 @@
+// Bench.h ... shared harness for the benchmark programs
+//
+// Each benchmark is an operation run over and over: after a warmup the
+// harness times a number of samples (each a batch of operations sized
+// to be long enough to time) and prints the mean and percentile
+// nanoseconds per operation, along with heap allocations per operation.
+//
+// Allocations are counted by wrapping malloc, calloc and realloc at
+// link time (see the bench target in the Makefile).
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "Globals.h"
+#include "Plays.h"
+#include "GameGen.h"
+
+#define BENCH_MAX_ROUNDS    200   // few legal games last longer
+#define BENCH_GAME_LENGTH   (BENCH_MAX_ROUNDS*NUM_PLAYERS*PLAY_LENGTH)
+
+// a benchmarked operation; i counts up from 0 so it can vary its input
+typedef void (*BenchOp)(void *arg, int i);
+
+// operations can add results here so the compiler can't drop the work
+extern volatile long benchSink;
+
+// prints the column headings for runBench()
+
+void benchHeader(char *title);
+
+// times op(arg, i) and prints one line of results under name
+
+void runBench(char *name, BenchOp op, void *arg);
+
+// fills plays with a game of the given number of complete rounds, as
+// Dracula sees it (his real locations), made by GameGen so every move
+// follows the rules. The same seed always gives the same game.
+// plays needs room for BENCH_GAME_LENGTH characters.
+
+void makeBenchGame(char *plays, int rounds, unsigned int seed);
+
+#endif
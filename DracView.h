@@ -9,6 +9,7 @@
 #include "Game.h"
 #include "Places.h"
 #include "GameView.h"
+#include "LocationSet.h"
 
 typedef struct dracView *DracView;
 
@@ -33,6 +34,13 @@ typedef struct dracView *DracView;
 DracView newDracView(char *pastPlays, PlayerMessage messages[]);
 
 
+// dracViewAppend() updates the view with plays made since it was created
+// (or last appended to), without re-reading the earlier ones.
+// See gameViewAppend() in GameView.h for the format of newPlays.
+
+void dracViewAppend(DracView currentView, char *newPlays, PlayerMessage messages[]);
+
+
 // disposeDracView() frees all memory previously allocated for the DracView
 // toBeDeleted. toBeDeleted should not be accessed after the call.
 
@@ -116,6 +124,13 @@ void giveMeTheTrail(DracView currentView, PlayerID player,
 
 LocationID *whereCanIgo(DracView currentView, int *numLocations, int road, int sea);
 
+// whereCanIgoInto() is whereCanIgo() writing into an array the caller
+//   provides (e.g. on the stack), returning the number of locations
+//   written. Nothing is allocated.
+
+int whereCanIgoInto(DracView currentView, LocationID locations[NUM_MAP_LOCATIONS],
+                    int road, int sea);
+
 // whereCanTheyGo() returns an array of LocationIDs giving all of the
 //   locations that the given Player could reach from their current location
 // road, rail and sea are connections should only be considered
@@ -131,4 +146,36 @@ LocationID *whereCanIgo(DracView currentView, int *numLocations, int road, int s
 LocationID *whereCanTheyGo(DracView currentView, int *numLocations,
                            PlayerID player, int road, int rail, int sea);
 
+// whereCanTheyGoInto() is whereCanTheyGo() writing into an array the caller
+//   provides, returning the number of locations written
+
+int whereCanTheyGoInto(DracView currentView, LocationID locations[NUM_MAP_LOCATIONS],
+                       PlayerID player, int road, int rail, int sea);
+
+// giveMeTheState() writes the state of the game into state (see
+//   getGameState() in GameView.h), with Dracula's real trail
+
+void giveMeTheState(DracView currentView, GameState *state);
+
+// whereDoTheyThinkIAm() returns the set of places the hunters could think
+//   Dracula is, from everything they have seen (as whereMightDraculaBe()
+//   in HunterView.h would give them)
+
+LocationSet whereDoTheyThinkIAm(DracView currentView);
+
+// howHiddenAfter() returns how many places the hunters could think
+//   Dracula is if he made move next (a move as legalDraculaMoves() in
+//   GameView.h gives them): 1 if they'd know where he is. With every
+//   place as likely, the hunters' uncertainty (entropy) is its log2.
+
+int howHiddenAfter(DracView currentView, LocationID move);
+
+// howHiddenAt() writes into hidden how many places the hunters could
+//   think Dracula is if he went to each of numLocations locations (as
+//   whereCanIgo() gives them), by the best move that gets him there,
+//   or 0 for a location he can't get to
+
+void howHiddenAt(DracView currentView, LocationID locations[], int numLocations,
+                 int hidden[]);
+
 #endif
@@ -0,0 +1,25 @@
+// Dracula.c ... Dracula's player
+//
+// The search lasts from one turn to the next, so what its transposition
+// table learnt about the positions ahead last turn is there this turn.
+
+#include <stdlib.h>
+#include "Globals.h"
+#include "Game.h"
+#include "DracView.h"
+#include "Dracula.h"
+#include "TimeBudget.h"
+#include "AlphaBeta.h"
+
+#define LOG2_TABLE     20     // 16MB transposition table
+
+static AlphaBeta search = NULL;
+
+// Searches for the best move for as long as the engine allows
+void decideDraculaMove(DracView gameState)
+{
+    if (search == NULL){
+        search = newAlphaBeta(LOG2_TABLE);
+    }
+    abDraculaMove(search, gameState, LIMIT_LIMIT_MSECS - BUDGET_SAFETY_MSECS);
+}
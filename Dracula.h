@@ -0,0 +1,17 @@
+// Dracula.h
+// Interface to Dracula's player
+// The game engine calls decideDraculaMove() on each of Dracula's turns
+
+#ifndef DRACULA_H
+#define DRACULA_H
+
+#include "DracView.h"
+
+// decideDraculaMove() works out Dracula's move, registering it with
+// registerBestPlay() (and improving on it) until it runs out of time.
+// A move is registered straight away, so the engine can stop it at
+// any point.
+
+void decideDraculaMove(DracView gameState);
+
+#endif
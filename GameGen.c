@@ -0,0 +1,211 @@
+// GameGen.c ... generating random games that follow the rules
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "Globals.h"
+#include "Places.h"
+#include "GameView.h"
+#include "GameGen.h"
+#include "Random.h"
+
+#define VAMPIRE_ROUNDS       13   // a vampire instead of a trap this often
+#define MAX_ENCOUNTERS       3    // traps and vampires allowed in one city
+#define LOW_HUNTER_HEALTH    4    // hunters this weak rest
+#define LOW_DRACULA_HEALTH   10   // Dracula this weak keeps off the sea
+
+struct gameGen {
+    uint64_t state;   // xorshift64* generator, never 0
+};
+
+static void makeHunterPlay(GameGen gen, GameView gv, PlayerID player, char play[]);
+static void makeDraculaPlay(GameGen gen, GameView gv, char play[]);
+static void moveCode(LocationID move, char code[2]);
+
+GameGen newGameGen(unsigned int seed)
+{
+    GameGen gen = malloc(sizeof(struct gameGen));
+    assert(gen != NULL);
+    //splitmix the seed so nearby seeds give unrelated games
+    uint64_t z = (uint64_t)seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    gen->state = z != 0 ? z : 1;
+    return gen;
+}
+
+void disposeGameGen(GameGen toBeDeleted)
+{
+    free(toBeDeleted);
+}
+
+// writes the next random game into plays, returns the number of plays
+int generateGame(GameGen gen, char *plays, int maxRounds)
+{
+    GameView gv = newGameView("", NULL);
+    int numPlays = 0;
+    plays[0] = '\0';
+
+    while (getRound(gv) < maxRounds && getScore(gv) > 0 &&
+           getHealth(gv, PLAYER_DRACULA) > 0){
+        PlayerID player = getCurrentPlayer(gv);
+        char play[PLAY_LENGTH];
+        if (player == PLAYER_DRACULA){
+            makeDraculaPlay(gen, gv, play);
+        } else {
+            makeHunterPlay(gen, gv, player, play);
+        }
+        play[PLAY_LENGTH-1] = '\0';
+        gameViewAppend(gv, play, NULL);
+
+        //plays are separated by spaces, the last one ends the string
+        char *next = &plays[numPlays*PLAY_LENGTH];
+        if (numPlays > 0){
+            next[-1] = ' ';
+        }
+        memcpy(next, play, PLAY_LENGTH);
+        numPlays ++;
+    }
+    disposeGameView(gv);
+    return numPlays;
+}
+
+// rewrites Dracula's moves in plays the way hunters see them
+void hideDracula(char *plays)
+{
+    int i, length = strlen(plays);
+    for (i = 0; i < length; i += PLAY_LENGTH){
+        LocationID where = abbrevToID(&plays[i+1]);
+        if (plays[i] == 'D' && validPlace(where) && where != CASTLE_DRACULA){
+            plays[i+1] = idToType(where) == SEA ? 'S' : 'C';
+            plays[i+2] = '?';
+        }
+    }
+}
+
+// a hunter moves (or rests) and runs into whatever is waiting there
+static void makeHunterPlay(GameGen gen, GameView gv, PlayerID player, char play[])
+{
+    LocationID from = getLocation(gv, player);
+    LocationID to;
+    if (from == UNKNOWN_LOCATION){
+        to = randomBelow(&gen->state, NUM_MAP_LOCATIONS);
+    } else if (getHealth(gv, player) <= LOW_HUNTER_HEALTH){
+        to = from;
+    } else {
+        LocationID options[NUM_MAP_LOCATIONS];
+        int numOptions = connectedLocationsInto(gv, options, from, player,
+                                                getRound(gv), TRUE, TRUE, TRUE);
+        to = options[randomBelow(&gen->state, numOptions)];
+    }
+
+    //health as processHunterPlay works it out, so that nothing is
+    //recorded after the hunter is sent to the hospital
+    int health = getHealth(gv, player);
+    if (health <= 0){
+        health = GAME_START_HUNTER_LIFE_POINTS;
+    }
+    if (to == from){
+        health += LIFE_GAIN_REST;
+        if (health > GAME_START_HUNTER_LIFE_POINTS){
+            health = GAME_START_HUNTER_LIFE_POINTS;
+        }
+    }
+
+    LocationID dracTrail[TRAIL_SIZE];
+    getLocationHistory(gv, PLAYER_DRACULA, dracTrail);
+    int numTraps, numVamps;
+    getMinions(gv, to, &numTraps, &numVamps);
+    int e = 0;
+    char *encounters = &play[FIRST_ENCOUNTER];
+    while (numTraps-- > 0 && e < ENCOUNTER_SLOTS && health > 0){
+        encounters[e++] = 'T';
+        health -= LIFE_LOSS_TRAP_ENCOUNTER;
+    }
+    if (numVamps > 0 && e < ENCOUNTER_SLOTS && health > 0){
+        encounters[e++] = 'V';
+    }
+    //there are no encounters at sea
+    if (to == dracTrail[0] && idToType(to) == LAND &&
+        e < ENCOUNTER_SLOTS && health > 0){
+        encounters[e++] = 'D';
+    }
+    while (e < ENCOUNTER_SLOTS){
+        encounters[e++] = '.';
+    }
+
+    play[0] = "GSHMD"[player];
+    moveCode(to, &play[1]);
+}
+
+// Dracula makes a legal move and leaves a minion behind if he can
+static void makeDraculaPlay(GameGen gen, GameView gv, char play[])
+{
+    LocationID moves[MAX_DRACULA_MOVES];
+    int numMoves = legalDraculaMoves(gv, moves, TRUE, TRUE);
+    assert(numMoves > 0);
+    LocationID trail[TRAIL_SIZE];
+    getLocationHistory(gv, PLAYER_DRACULA, trail);
+
+    //try a few times for a move that doesn't strand him at sea
+    LocationID move, where;
+    int tries = 0;
+    do {
+        move = moves[randomBelow(&gen->state, numMoves)];
+        where = moveDestination(trail, move);
+        tries ++;
+    } while (idToType(where) == SEA && tries < numMoves &&
+             getHealth(gv, PLAYER_DRACULA) <= LOW_DRACULA_HEALTH);
+
+    char *encounters = &play[FIRST_ENCOUNTER];
+    memcpy(encounters, "....", ENCOUNTER_SLOTS);
+
+    //minions only go in cities, and only so many in each
+    if (idToType(where) == LAND){
+        int numTraps, numVamps;
+        getMinions(gv, where, &numTraps, &numVamps);
+        int oldTraps, oldVamps;
+        getTrailMinions(gv, TRAIL_SIZE-1, &oldTraps, &oldVamps);
+        if (trail[TRAIL_SIZE-1] == where){
+            //these are about to leave the trail
+            numTraps -= oldTraps;
+            numVamps -= oldVamps;
+        }
+        if (numTraps + numVamps < MAX_ENCOUNTERS){
+            if (getRound(gv) % VAMPIRE_ROUNDS == 0){
+                encounters[1] = 'V';
+            } else {
+                encounters[0] = 'T';
+            }
+        }
+    }
+
+    //the oldest move leaves the trail: a vampire matures, traps vanish
+    int oldTraps, oldVamps;
+    getTrailMinions(gv, TRAIL_SIZE-1, &oldTraps, &oldVamps);
+    if (oldVamps > 0){
+        encounters[2] = 'V';
+    } else if (oldTraps > 0){
+        encounters[2] = 'M';
+    }
+
+    play[0] = 'D';
+    moveCode(move, &play[1]);
+}
+
+// the two characters recorded in a play for a move
+static void moveCode(LocationID move, char code[2])
+{
+    if (move == HIDE){
+        memcpy(code, "HI", 2);
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+        code[0] = 'D';
+        code[1] = '1' + (move - DOUBLE_BACK_1);
+    } else if (move == TELEPORT){
+        memcpy(code, "TP", 2);
+    } else {
+        memcpy(code, idToAbbrev(move), 2);
+    }
+}
@@ -0,0 +1,45 @@
+// GameGen.h ... generating random games that follow the rules
+//
+// A GameGen plays both sides at random, but only ever makes legal
+// moves: hunters move by road, rail (as far as the round allows) and
+// sea or rest; Dracula keeps to his trail rules (no revisiting his
+// trail, at most one HIDE and one DOUBLE_BACK in it, teleporting home
+// when stuck), leaves traps and immature vampires in the cities he
+// visits, and the encounters, maturing vampires and hospital visits
+// recorded in each play are the ones the rules say happen.
+//
+// Games are written as pastPlays strings the way Dracula sees them
+// (his real moves); hideDracula() gives the hunters' version.
+// The same seed always gives the same sequence of games.
+
+#ifndef GAME_GEN_H
+#define GAME_GEN_H
+
+#include "Globals.h"
+#include "Plays.h"
+
+// the score drops every round, so no game can go on for longer than this
+#define MAX_GAME_ROUNDS    GAME_START_SCORE
+#define MAX_GAME_LENGTH    (MAX_GAME_ROUNDS*NUM_PLAYERS*PLAY_LENGTH)
+
+typedef struct gameGen *GameGen;
+
+GameGen newGameGen(unsigned int seed);
+void disposeGameGen(GameGen toBeDeleted);
+
+// writes the next random game into plays, returns the number of plays
+// The game stops when it is over (Dracula has no blood points left or
+//   the score reaches zero) or after maxRounds complete rounds,
+//   whichever comes first.
+// plays needs room for maxRounds*NUM_PLAYERS*PLAY_LENGTH characters
+//   (MAX_GAME_LENGTH is always enough).
+
+int generateGame(GameGen gen, char *plays, int maxRounds);
+
+// rewrites Dracula's moves in plays the way hunters see them
+// (CITY_UNKNOWN or SEA_UNKNOWN, except at Castle Dracula; HIDE,
+// DOUBLE_BACK_N and TELEPORT are always shown)
+
+void hideDracula(char *plays);
+
+#endif
@@ -0,0 +1,404 @@
+// GameState.c ... the state of a game as a small plain struct, for search
+
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "Places.h"
+#include "Map.h"
+#include "Plays.h"
+#include "GameState.h"
+
+#define TRAIL_BYTES  ((1ULL << (8*TRAIL_SIZE)) - 1)
+#define TRAIL_NIBBLES ((1U << (MINION_BITS*TRAIL_SIZE)) - 1)
+#define SLOT_MASK    ((1 << TRAIL_SIZE) - 1)
+
+#define VAMPIRE_ROUNDS   13   // a vampire instead of a trap this often
+#define MAX_ENCOUNTERS   3    // traps and vampires allowed in one city
+
+// sizes of the Zobrist key tables
+#define LOCATION_CODES         128  // every LocationID fits in 7 bits
+#define HEALTH_CODES           16
+#define DRACULA_HEALTH_CODES   64   // his health only changes by even amounts
+#define SCORE_CODES            512
+
+// a random key for each value each part of a state can have
+static struct zobristKeys {
+    uint64_t curr[NUM_PLAYERS];
+    uint64_t oddRound;
+    uint64_t score[SCORE_CODES];
+    uint64_t draculaHealth[DRACULA_HEALTH_CODES];
+    uint64_t health[NUM_HUNTERS][HEALTH_CODES];
+    uint64_t location[NUM_HUNTERS][LOCATION_CODES];
+    uint64_t trailMove[TRAIL_SIZE][LOCATION_CODES];
+    uint64_t trailWhere[TRAIL_SIZE][LOCATION_CODES];
+    uint64_t minions[TRAIL_SIZE][1 << MINION_BITS];
+} keys;
+static pthread_once_t keysMade = PTHREAD_ONCE_INIT;
+
+static void makeKeys(void);
+static uint64_t turnHash(const GameState *state);
+static uint64_t hunterHash(const GameState *state, PlayerID hunter);
+static uint64_t trailHash(uint64_t trailMoves, uint64_t trailWhere);
+static uint64_t minionHash(uint32_t trailMinions);
+static void applyHunterMove(GameState *state, LocationID move, Undo *undo);
+static void applyDraculaMove(GameState *state, LocationID move, Undo *undo);
+
+// sets up the state at the start of the game
+void initGameState(GameState *state)
+{
+    //clear the padding too, so states can be compared with memcmp
+    memset(state, 0, sizeof(GameState));
+    state->trailMoves = TRAIL_BYTES;   //every byte UNKNOWN_LOCATION
+    state->trailWhere = TRAIL_BYTES;
+    state->score = GAME_START_SCORE;
+    state->draculaHealth = GAME_START_BLOOD_POINTS;
+    state->curr = PLAYER_LORD_GODALMING;
+    int i;
+    for (i = 0; i < NUM_HUNTERS; i++){
+        state->health[i] = GAME_START_HUNTER_LIFE_POINTS;
+        state->location[i] = UNKNOWN_LOCATION;
+    }
+    pthread_once(&keysMade, makeKeys);
+    state->hash = hashGameState(state);
+}
+
+// plays move for the current player
+void applyMove(GameState *state, LocationID move, Undo *undo)
+{
+    undo->hash = state->hash;
+    undo->trailMinions = state->trailMinions;
+    undo->score = state->score;
+    undo->draculaHealth = state->draculaHealth;
+
+    //take out the keys for what the move can change, and put them back
+    //once it is made
+    uint64_t hash = state->hash ^ turnHash(state);
+    if (state->curr == PLAYER_DRACULA){
+        hash ^= trailHash(state->trailMoves, state->trailWhere);
+        applyDraculaMove(state, move, undo);
+        hash ^= trailHash(state->trailMoves, state->trailWhere);
+    } else {
+        PlayerID hunter = state->curr;
+        hash ^= hunterHash(state, hunter);
+        applyHunterMove(state, move, undo);
+        hash ^= hunterHash(state, hunter);
+    }
+    if (state->trailMinions != undo->trailMinions){
+        hash ^= minionHash(undo->trailMinions) ^ minionHash(state->trailMinions);
+    }
+    state->hash = hash ^ turnHash(state);
+}
+
+// takes back the last move applied
+void undoMove(GameState *state, const Undo *undo)
+{
+    if (state->curr == PLAYER_LORD_GODALMING){
+        //it was Dracula's move, his oldest move comes back on the trail
+        state->curr = PLAYER_DRACULA;
+        state->round --;
+        state->trailMoves = (state->trailMoves >> 8) |
+                            (uint64_t)(uint8_t)undo->droppedMove << (8*(TRAIL_SIZE-1));
+        state->trailWhere = (state->trailWhere >> 8) |
+                            (uint64_t)(uint8_t)undo->droppedWhere << (8*(TRAIL_SIZE-1));
+    } else {
+        state->curr --;
+        state->health[state->curr] = undo->health;
+        state->location[state->curr] = undo->location;
+    }
+    state->trailMinions = undo->trailMinions;
+    state->score = undo->score;
+    state->draculaHealth = undo->draculaHealth;
+    state->hash = undo->hash;
+}
+
+// the Zobrist hash of state worked out from scratch
+uint64_t hashGameState(const GameState *state)
+{
+    uint64_t hash = turnHash(state);
+    int i;
+    for (i = 0; i < NUM_HUNTERS; i++){
+        hash ^= hunterHash(state, i);
+    }
+    hash ^= trailHash(state->trailMoves, state->trailWhere);
+    return hash ^ minionHash(state->trailMinions);
+}
+
+// TRUE if the game is over
+int isGameOver(const GameState *state)
+{
+    return state->score <= 0 || state->draculaHealth <= 0;
+}
+
+// fills moves with every legal move for the current player
+int legalMoves(const GameState *state, LocationID moves[MAX_MOVES])
+{
+    if (state->curr == PLAYER_DRACULA){
+        return draculaMoves(state, moves, TRUE, TRUE);
+    }
+    return hunterMoves(state, state->curr, moves);
+}
+
+// every move the hunter could make next
+int hunterMoves(const GameState *state, PlayerID hunter,
+                LocationID moves[NUM_MAP_LOCATIONS])
+{
+    LocationID from = state->location[hunter];
+    if (from == UNKNOWN_LOCATION){
+        return setToArray(setAll(), moves);
+    }
+    //hunters move later in the round than the current player
+    //if they have already moved this round
+    int round = hunter >= state->curr ? state->round : state->round + 1;
+    Map map = newMap();
+    LocationSet reachable = setOf(from);
+    reachable = setUnion(reachable, connectionSet(map, from, ROAD));
+    reachable = setUnion(reachable, connectionSet(map, from, BOAT));
+    reachable = setUnion(reachable, railReachable(map, from, (hunter + round) % 4));
+    return setToArray(reachable, moves);
+}
+
+// every move Dracula could make next
+int draculaMoves(const GameState *state, LocationID moves[MAX_DRACULA_MOVES],
+                 int road, int sea)
+{
+    LocationID whereAmI = trailWhere(state, 0);
+    if (whereAmI == UNKNOWN_LOCATION){
+        //first move - anywhere but the hospital
+        LocationSet anywhere = setAll();
+        setRemove(&anywhere, ST_JOSEPH_AND_ST_MARYS);
+        return setToArray(anywhere, moves);
+    }
+    if (!validPlace(whereAmI)){
+        return 0;
+    }
+
+    //the oldest move drops off the trail as he makes this one, so only
+    //the last TRAIL_SIZE-1 moves restrict him
+    int alreadyHid = FALSE;
+    int alreadyDoubledBack = FALSE;
+    LocationSet inTrail = setEmpty();
+    int i;
+    for (i = 0; i < TRAIL_SIZE-1; i++){
+        LocationID move = trailMove(state, i);
+        LocationID where = trailWhere(state, i);
+        if (move == HIDE){
+            alreadyHid = TRUE;
+        } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+            alreadyDoubledBack = TRUE;
+        }
+        if (validPlace(where)){
+            setAdd(&inTrail, where);
+        }
+    }
+
+    //dracula does not move by rail, or to the hospital !
+    Map map = newMap();
+    LocationSet adjacent = setOf(whereAmI);
+    if (road == TRUE){
+        adjacent = setUnion(adjacent, connectionSet(map, whereAmI, ROAD));
+    }
+    if (sea == TRUE){
+        adjacent = setUnion(adjacent, connectionSet(map, whereAmI, BOAT));
+    }
+    setRemove(&adjacent, ST_JOSEPH_AND_ST_MARYS);
+
+    int numMoves = setToArray(setMinus(adjacent, inTrail), moves);
+    if (!alreadyHid && idToType(whereAmI) == LAND){
+        moves[numMoves++] = HIDE;
+    }
+    if (!alreadyDoubledBack){
+        for (i = 0; i < TRAIL_SIZE-1; i++){
+            LocationID where = trailWhere(state, i);
+            if (validPlace(where) && setHas(adjacent, where)){
+                moves[numMoves++] = DOUBLE_BACK_1 + i;
+            }
+        }
+    }
+    //with nowhere to go he teleports home
+    if (numMoves == 0){
+        moves[numMoves++] = TELEPORT;
+    }
+    return numMoves;
+}
+
+// the slots of Dracula's trail that left him at where, as a bit mask
+int trailSlotsAt(const GameState *state, LocationID where)
+{
+    //a byte of x is zero where the trail has where in it
+    uint64_t x = state->trailWhere ^ (ONES * (uint8_t)where);
+    uint64_t zero = ~(((x & LOW7) + LOW7) | x | LOW7) & HIGHS;
+    return (int)(((zero >> 7) * GATHER) >> 56) & SLOT_MASK;
+}
+
+// traps and vampires waiting at where
+void stateMinions(const GameState *state, LocationID where,
+                  int *numTraps, int *numVamps)
+{
+    *numTraps = 0;
+    *numVamps = 0;
+    if (!validPlace(where) || idToType(where) == SEA){
+        return;
+    }
+    int slots = trailSlotsAt(state, where);
+    while (slots != 0){
+        int minions = trailMinions(state, __builtin_ctz(slots));
+        *numTraps += minions & MINION_TRAPS;
+        *numVamps += (minions & MINION_VAMPIRE) != 0;
+        slots &= slots - 1;
+    }
+}
+
+// fills the key tables with splitmix64 numbers (the same every run)
+static void makeKeys(void)
+{
+    uint64_t *key = (uint64_t *)&keys;
+    uint64_t seed = 0;
+    size_t i;
+    for (i = 0; i < sizeof(keys)/sizeof(uint64_t); i++){
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        key[i] = z ^ (z >> 31);
+    }
+}
+
+// keys for the parts of the state any move may change
+static uint64_t turnHash(const GameState *state)
+{
+    int score = state->score < 0 ? 0 : state->score;
+    int blood = state->draculaHealth < 0 ? 0 : state->draculaHealth/2;
+    if (score >= SCORE_CODES) score = SCORE_CODES-1;
+    if (blood >= DRACULA_HEALTH_CODES) blood = DRACULA_HEALTH_CODES-1;
+    return keys.curr[state->curr] ^ (state->round & 1 ? keys.oddRound : 0) ^
+           keys.score[score] ^ keys.draculaHealth[blood];
+}
+
+// keys for where a hunter is and how healthy they are
+static uint64_t hunterHash(const GameState *state, PlayerID hunter)
+{
+    return keys.location[hunter][state->location[hunter] & (LOCATION_CODES-1)] ^
+           keys.health[hunter][state->health[hunter]];
+}
+
+// keys for each move of Dracula's trail
+static uint64_t trailHash(uint64_t trailMoves, uint64_t trailWhere)
+{
+    uint64_t hash = 0;
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        hash ^= keys.trailMove[i][(trailMoves >> (8*i)) & (LOCATION_CODES-1)];
+        hash ^= keys.trailWhere[i][(trailWhere >> (8*i)) & (LOCATION_CODES-1)];
+    }
+    return hash;
+}
+
+// keys for the minions left by each move of the trail
+static uint64_t minionHash(uint32_t trailMinions)
+{
+    uint64_t hash = 0;
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        hash ^= keys.minions[i][(trailMinions >> (MINION_BITS*i)) & ((1 << MINION_BITS) - 1)];
+    }
+    return hash;
+}
+
+// a hunter moves and runs into whatever is waiting there
+static void applyHunterMove(GameState *state, LocationID move, Undo *undo)
+{
+    PlayerID hunter = state->curr;
+    int health = state->health[hunter];
+    undo->health = health;
+    undo->location = state->location[hunter];
+
+    //hunters sent to the hospital are patched up by their next turn
+    if (health <= 0){
+        health = GAME_START_HUNTER_LIFE_POINTS;
+    }
+    //gains 3 when resting
+    if (move == state->location[hunter]){
+        health += LIFE_GAIN_REST;
+        if (health > GAME_START_HUNTER_LIFE_POINTS){
+            health = GAME_START_HUNTER_LIFE_POINTS;
+        }
+    }
+    state->location[hunter] = move;
+
+    //there are no encounters at sea
+    if (validPlace(move) && idToType(move) == LAND){
+        int slots = trailSlotsAt(state, move);
+        //traps first, until they run out or he does
+        int s;
+        for (s = 0; s < TRAIL_SIZE && health > 0; s++){
+            if ((slots >> s) & 1){
+                int shift = MINION_BITS*s;
+                while (((state->trailMinions >> shift) & MINION_TRAPS) != 0 && health > 0){
+                    state->trailMinions -= 1U << shift;
+                    health -= LIFE_LOSS_TRAP_ENCOUNTER;
+                }
+            }
+        }
+        //then any vampire is staked
+        if (health > 0){
+            for (s = 0; s < TRAIL_SIZE; s++){
+                if ((slots >> s) & 1){
+                    state->trailMinions &= ~(MINION_VAMPIRE << (MINION_BITS*s));
+                }
+            }
+        }
+        //then Dracula himself
+        if ((slots & 1) && health > 0){
+            health -= LIFE_LOSS_DRACULA_ENCOUNTER;
+            state->draculaHealth -= LIFE_LOSS_HUNTER_ENCOUNTER;
+        }
+    }
+
+    //hunters with no life points left are teleported to the hospital
+    if (health <= 0){
+        health = 0;
+        state->location[hunter] = ST_JOSEPH_AND_ST_MARYS;
+        state->score -= SCORE_LOSS_HUNTER_HOSPITAL;
+    }
+    state->health[hunter] = health;
+    state->curr ++;
+}
+
+// Dracula moves, leaves a minion behind and ends the round
+static void applyDraculaMove(GameState *state, LocationID move, Undo *undo)
+{
+    LocationID trail[TRAIL_SIZE];
+    trailPlaces(state, trail);
+    LocationID where = moveDestination(trail, move);
+
+    //the oldest move leaves the trail, a vampire still there matures
+    undo->droppedMove = trailMove(state, TRAIL_SIZE-1);
+    undo->droppedWhere = trailWhere(state, TRAIL_SIZE-1);
+    if (trailMinions(state, TRAIL_SIZE-1) & MINION_VAMPIRE){
+        state->score -= SCORE_LOSS_VAMPIRE_MATURES;
+    }
+    state->trailMoves = ((state->trailMoves << 8) | (uint8_t)move) & TRAIL_BYTES;
+    state->trailWhere = ((state->trailWhere << 8) | (uint8_t)where) & TRAIL_BYTES;
+    state->trailMinions = (state->trailMinions << MINION_BITS) & TRAIL_NIBBLES;
+
+    //minions only go in cities, and only so many in each
+    if (validPlace(where) && idToType(where) == LAND){
+        int numTraps, numVamps;
+        stateMinions(state, where, &numTraps, &numVamps);
+        if (numTraps + numVamps < MAX_ENCOUNTERS){
+            state->trailMinions |= state->round % VAMPIRE_ROUNDS == 0 ? MINION_VAMPIRE : 1;
+        }
+    }
+
+    //loses 2 each turn at sea
+    if (where == SEA_UNKNOWN || (validPlace(where) && idToType(where) == SEA)){
+        state->draculaHealth -= LIFE_LOSS_SEA;
+    }
+    //gains 10 if in Castle Dracula at end of turn
+    if (where == CASTLE_DRACULA){
+        state->draculaHealth += LIFE_GAIN_CASTLE_DRACULA;
+    }
+    state->score -= SCORE_LOSS_DRACULA_TURN;
+    state->round ++;
+    state->curr = PLAYER_LORD_GODALMING;
+}
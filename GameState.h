@@ -0,0 +1,148 @@
+// GameState.h ... the state of a game as a small plain struct, for search
+//
+// A GameState holds everything the rules need to carry on the game from
+// a position: round, score, whose turn it is, health and location of
+// every player, and Dracula's trail with the traps and vampires left
+// along it. It has no pointers and is 48 bytes, so it can be copied
+// with = and many fit in cache.
+//
+// applyMove() plays a move under the full rules (encounters, resting,
+// hospital visits, trail rules, minions placed and matured, score) and
+// undoMove() takes it back again; both are a few word operations.
+//
+// Dracula's trail is packed a byte per move into words, latest move in
+// the lowest byte, so adding a move is a shift and finding the moves
+// that left him somewhere compares all six bytes at once.
+//
+// Every state carries a 64-bit Zobrist hash of itself, kept up to date
+// by applyMove() and undoMove() with a few XORs, for looking positions
+// up in a transposition table (see TransTable.h). It covers whose turn
+// it is, the round's parity, the score, everyone's location and health
+// and Dracula's trail with the minions along it.
+
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "LocationSet.h"
+
+#define NUM_HUNTERS          4
+
+// most moves any player can have (see draculaMoves())
+#define MAX_DRACULA_MOVES    (NUM_MAP_LOCATIONS + TRAIL_SIZE)
+#define MAX_MOVES            MAX_DRACULA_MOVES
+
+// minions left by each move of the trail, a nibble each
+#define MINION_BITS          4
+#define MINION_TRAPS         3    // number of traps, 0...3
+#define MINION_VAMPIRE       4    // set if an immature vampire is there
+
+typedef struct gameState {
+    uint64_t hash;         // Zobrist hash of everything below
+    uint64_t trailMoves;   // byte i: Dracula's move i moves ago, as recorded
+    uint64_t trailWhere;   // byte i: where that move took him
+    uint32_t trailMinions; // nibble i: what that move left behind
+    int16_t  score;
+    int16_t  round;
+    int16_t  draculaHealth;
+    int8_t   curr;
+    int8_t   health[NUM_HUNTERS];
+    int8_t   location[NUM_HUNTERS];
+} GameState;
+
+_Static_assert(sizeof(GameState) == 48, "GameState is 48 bytes, as above");
+
+// what applyMove() overwrote, for undoMove()
+typedef struct undo {
+    uint64_t hash;
+    uint32_t trailMinions;
+    int16_t  score;
+    int16_t  draculaHealth;
+    int8_t   health;         // of the hunter who moved
+    int8_t   location;       // of the hunter who moved
+    int8_t   droppedMove;    // Dracula's move that left the trail
+    int8_t   droppedWhere;
+} Undo;
+
+// sets up the state at the start of the game
+
+void initGameState(GameState *state);
+
+// plays move for the current player: a location for hunters; a
+// location, HIDE, DOUBLE_BACK_N or TELEPORT for Dracula (CITY_UNKNOWN
+// and SEA_UNKNOWN are accepted too, but leave no minions behind)
+// Hunters run into whatever is at their destination; Dracula leaves a
+// vampire in a city every 13th round and a trap the rest of the time,
+// unless there are already 3 there.
+// The move isn't checked for legality - see legalMoves().
+// undo is filled in so undoMove() can take the move back.
+
+void applyMove(GameState *state, LocationID move, Undo *undo);
+
+// takes back the last move applied, given what applyMove() filled in
+
+void undoMove(GameState *state, const Undo *undo);
+
+// the Zobrist hash of state worked out from scratch, which is always
+// the same as state->hash
+
+uint64_t hashGameState(const GameState *state);
+
+// TRUE if the game is over (Dracula has no blood or the score is gone)
+
+int isGameOver(const GameState *state);
+
+// fills moves with every legal move for the current player, returns
+// how many (0 if Dracula's location isn't known)
+
+int legalMoves(const GameState *state, LocationID moves[MAX_MOVES]);
+
+// every move the hunter could make next (where they are now included)
+
+int hunterMoves(const GameState *state, PlayerID hunter,
+                LocationID moves[NUM_MAP_LOCATIONS]);
+
+// every move Dracula could make next, as legalDraculaMoves() in GameView.h
+
+int draculaMoves(const GameState *state, LocationID moves[MAX_DRACULA_MOVES],
+                 int road, int sea);
+
+// the slots of Dracula's trail that left him at where, as a bit mask
+// (bit i for the move i moves ago)
+
+int trailSlotsAt(const GameState *state, LocationID where);
+
+// traps and vampires waiting at where
+
+void stateMinions(const GameState *state, LocationID where,
+                  int *numTraps, int *numVamps);
+
+// Dracula's move i moves ago, and where it took him
+
+static inline LocationID trailMove(const GameState *state, int i)
+{
+    return (int8_t)(state->trailMoves >> (8*i));
+}
+
+static inline LocationID trailWhere(const GameState *state, int i)
+{
+    return (int8_t)(state->trailWhere >> (8*i));
+}
+
+// where each move in Dracula's trail took him, most recent first
+static inline void trailPlaces(const GameState *state, LocationID trail[TRAIL_SIZE])
+{
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        trail[i] = trailWhere(state, i);
+    }
+}
+
+static inline int trailMinions(const GameState *state, int i)
+{
+    return (state->trailMinions >> (MINION_BITS*i)) & ((1 << MINION_BITS) - 1);
+}
+
+#endif
@@ -8,72 +8,82 @@
 #include "Game.h"
 #include "GameView.h"
 #include "Map.h"
-
-#define NUM_HUNTERS          4
-#define MAX_ENCOUNTERS       4
-#define PLAY_STRING_LENGTH   7
+#include "Plays.h"
+#include "GameState.h"
 
 typedef struct Hunter {
-    PlayerID ID;
     int health;
     int deaths;
-    LocationID location;
+    LocationID location;           // where the hunter is now (hospital if dead)
+    LocationID trail[TRAIL_SIZE];  // moves as recorded in pastPlays
 } Hunter;
 
 typedef struct Dracula {
     int health;
-    LocationID location;
-    LocationID trail[TRAIL_SIZE];
+    LocationID trail[TRAIL_SIZE];  // moves as recorded (C?, HI, D1, ...)
+    LocationID where[TRAIL_SIZE];  // what each move resolved to
+    int traps[TRAIL_SIZE];         // traps left by each move in the trail
+    int vampire[TRAIL_SIZE];       // TRUE if that move left an immature vampire
 } Dracula;
 
 struct gameView {
     Map map;
     int score;
     Round round;
+    PlayerID curr; //current player
     Hunter hunters[NUM_HUNTERS];
     Dracula dracula;
-    char *playRecord;
-    int curr; //current player
-    //record traps and vampires in which locations...
 };
 
 //static functions
-static connectionList getUniqueLocations(connectionList list, LocationID origin, PlayerID player);
-static connectionList mergeConnectionLists(connectionList oldList, connectionList newList);
-static int hospitalVisits(GameView currentView, PlayerID player);
-static int numMaturedVampires(GameView currentView);
-static int trapsEncountered(GameView currentView, PlayerID player);
-static int timesDraculaEncountered(GameView currentView, PlayerID player);
-static int turnsHunterRested(GameView currentView, PlayerID player);
-static int turnsDracAtSea(GameView currentView);
-static int turnsDracAtCastleDrac(GameView currentView);
+static void processPlay(void *view, const Play *play);
+static void processHunterPlay(GameView gameView, Hunter *hunter, const Play *play);
+static void processDraculaPlay(GameView gameView, const Play *play);
+static void pushTrail(LocationID trail[TRAIL_SIZE], LocationID location);
 
 // Creates a new GameView to summarise the current state of the game
+// pastPlays is read once, front to back; every query afterwards just
+// reads the fields filled in here
 GameView newGameView(char *pastPlays, PlayerMessage messages[])
 {
     GameView gameView = malloc(sizeof(struct gameView));
+    assert(gameView != NULL);
     gameView->map = newMap();
-    gameView->playRecord = malloc(sizeof(char)*strlen(pastPlays));
-    strcpy(gameView->playRecord, pastPlays);
-    gameView->round = getRound(gameView);
-    gameView->curr = getCurrentPlayer(gameView);
-    gameView->score = getScore(gameView);
+    gameView->score = GAME_START_SCORE;
+    gameView->round = 0;
+    gameView->curr = PLAYER_LORD_GODALMING;
 
     //Initialize hunters
-    int i;
+    int i, j;
     for(i = 0; i < NUM_HUNTERS; i++)
     {
-        gameView->hunters[i].ID = i;
-        gameView->hunters[i].health = getHealth(gameView, i);
-        gameView->hunters[i].deaths = hospitalVisits(gameView, i);
+        gameView->hunters[i].health = GAME_START_HUNTER_LIFE_POINTS;
+        gameView->hunters[i].deaths = 0;
+        gameView->hunters[i].location = UNKNOWN_LOCATION;
+        for (j = 0; j < TRAIL_SIZE; j++){
+            gameView->hunters[i].trail[j] = UNKNOWN_LOCATION;
+        }
     }
 
     //Initialize Dracula
-    gameView->dracula.health = getHealth(gameView, PLAYER_DRACULA);
+    gameView->dracula.health = GAME_START_BLOOD_POINTS;
+    for (j = 0; j < TRAIL_SIZE; j++){
+        gameView->dracula.trail[j] = UNKNOWN_LOCATION;
+        gameView->dracula.where[j] = UNKNOWN_LOCATION;
+        gameView->dracula.traps[j] = 0;
+        gameView->dracula.vampire[j] = FALSE;
+    }
 
+    gameViewAppend(gameView, pastPlays, messages);
     return gameView;
 }
 
+// Brings the GameView up to date with plays made since it was created
+void gameViewAppend(GameView currentView, char *newPlays, PlayerMessage messages[])
+{
+    forEachPlay(newPlays, processPlay, currentView);
+}
+
 
 // Frees all memory previously allocated for the GameView toBeDeleted
 void disposeGameView(GameView toBeDeleted)
@@ -87,90 +97,64 @@ void disposeGameView(GameView toBeDeleted)
 // Get the current round
 Round getRound(GameView currentView)
 {
-    Round numRounds;
-    int playStringLength = (int)strlen(currentView->playRecord);
-    numRounds = (playStringLength+1)/((PLAY_STRING_LENGTH+1)*NUM_PLAYERS);
-    return numRounds;
+    return currentView->round;
 }
 
 // Get the id of current player - ie whose turn is it?
 PlayerID getCurrentPlayer(GameView currentView)
 {
-    char lastPlayerChar;
-    PlayerID lastPlayer=-1;
-    PlayerID thisPlayer;
-    char playerIdentifier[NUM_PLAYERS] = {'G', 'S', 'H', 'M', 'D'};
-    lastPlayerChar = currentView->playRecord[strlen(currentView->playRecord)-PLAY_STRING_LENGTH];
-    int index;
-    for (index = 0; index < NUM_PLAYERS; index++){
-        if (lastPlayerChar == playerIdentifier[index]){
-            lastPlayer = index;
-        }
-    }
-    if (lastPlayer == PLAYER_DRACULA || strlen(currentView->playRecord)==0){
-        thisPlayer = PLAYER_LORD_GODALMING;
-    } else {
-        thisPlayer = lastPlayer + 1;
-    }
-
-    return thisPlayer;
+    return currentView->curr;
 }
 
 // Get the current score
 int getScore(GameView currentView)
 {
-    int score = GAME_START_SCORE;
-    //minus 1 for each round completed
-    score -= getRound(currentView);
-    //minus 6 for each hospital visit
-    PlayerID player;
-    for (player=0; player<NUM_HUNTERS; player++){
-        score -= 6*hospitalVisits(currentView, player);
-    }
-    //minus 13 for each vampire fallen off trail (matured)
-    score -= 13*numMaturedVampires(currentView);
-    return score;
+    return currentView->score;
 }
 
 // Get the current health points for a given player
 int getHealth(GameView currentView, PlayerID player)
 {
-    int health = 0;
     if (player == PLAYER_DRACULA){
-        health += 40;
-        //loses 10 when encountered a hunter
-        PlayerID player;
-        for (player = 0; player < NUM_HUNTERS; player++){
-            health -= 10*timesDraculaEncountered(currentView, player);
-        }
-        //loses 2 each turn at sea
-        health -= 2*turnsDracAtSea(currentView);
-        //gains 10 if in Castle Dracula at end of turn and not yet defeated
-        health += 10*turnsDracAtCastleDrac(currentView);
-
-    } else {
-        health += 9;
-        //loses 2 when encounters a trap
-        health -= 2*trapsEncountered(currentView, player);
-        //loses 4 when encounters dracula
-        health -= 4*timesDraculaEncountered(currentView, player);
-        //gains 3 when rest in a city (in same city for 2 turns)
-        health += 3*turnsHunterRested(currentView, player);
-        //cannot exceed 9 points.
-        if (health > 9){
-            health = 9;
-        }
+        return currentView->dracula.health;
     }
-    return health;
+    return currentView->hunters[player].health;
 }
 
 // Get the current location id of a given player
 LocationID getLocation(GameView currentView, PlayerID player)
 {
-    LocationID playerTrail[TRAIL_SIZE];
-    getHistory(currentView, player, playerTrail);
-    LocationID playerLocation = playerTrail[0];
-    return playerLocation;
+    if (player == PLAYER_DRACULA){
+        return currentView->dracula.trail[0];
+    }
+    return currentView->hunters[player].location;
+}
+
+// Find out what minions are placed at the specified location
+void getMinions(GameView currentView, LocationID where,
+                int *numTraps, int *numVamps)
+{
+    *numTraps = 0;
+    *numVamps = 0;
+    if (!validPlace(where) || idToType(where) == SEA){
+        return;
+    }
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        if (currentView->dracula.where[i] == where){
+            *numTraps += currentView->dracula.traps[i];
+            *numVamps += currentView->dracula.vampire[i];
+        }
+    }
+}
+
+// Find out what minions Dracula left with the move trailIndex moves ago
+void getTrailMinions(GameView currentView, int trailIndex,
+                     int *numTraps, int *numVamps)
+{
+    assert(trailIndex >= 0 && trailIndex < TRAIL_SIZE);
+    *numTraps = currentView->dracula.traps[trailIndex];
+    *numVamps = currentView->dracula.vampire[trailIndex];
 }
 
 //// Functions that return information about the history of the game
@@ -179,307 +163,236 @@ LocationID getLocation(GameView currentView, PlayerID player)
 void getHistory(GameView currentView, PlayerID player,
                 LocationID trail[TRAIL_SIZE])
 {
-    //take in string of moves from currentView
-    char playerIdentifier[NUM_PLAYERS] = {'G', 'S', 'H', 'M', 'D'};
-    char thisPlayer = playerIdentifier[player];
-    int trailCounter;
-
-    //start all trail locations as unknown
-    for (trailCounter = 0; trailCounter < TRAIL_SIZE; trailCounter ++){
-        trail[trailCounter] = UNKNOWN_LOCATION;
+    LocationID *playerTrail;
+    if (player == PLAYER_DRACULA){
+        playerTrail = currentView->dracula.trail;
+    } else {
+        playerTrail = currentView->hunters[player].trail;
     }
-    trailCounter = 0;
-    //find past 6 trail locations of character (backwards from end of string)
-    //assuming a string from currentView called playRecord
-    int thisIndex;
-    int stringLength = (int) strlen(currentView->playRecord);
-    LocationID location;
-    char locationAbbrev[2];
-    for (thisIndex = stringLength-PLAY_STRING_LENGTH; thisIndex >= 0 && trailCounter < TRAIL_SIZE; thisIndex -= (PLAY_STRING_LENGTH+1)){
-        if (currentView->playRecord[thisIndex] == thisPlayer){
-            locationAbbrev[0] = currentView->playRecord[thisIndex+1];
-            locationAbbrev[1] = currentView->playRecord[thisIndex+2];
-            location = abbrevToID(locationAbbrev);
-            if (location != NOWHERE){
-                trail[trailCounter] = location;
-            } else {   //Special Cases for Dracula's Moves!
-                if (strncmp(locationAbbrev, "C?", 2)==0){
-                    trail[trailCounter] = CITY_UNKNOWN;
-                } else if (strncmp(locationAbbrev, "S?", 2)==0){
-                    trail[trailCounter] = SEA_UNKNOWN;
-                } else if (strncmp(locationAbbrev, "HI", 2)==0){
-                    trail[trailCounter] = HIDE;
-                } else if (strncmp(locationAbbrev, "TP", 2)==0){
-                    trail[trailCounter] = TELEPORT;
-                } else if (locationAbbrev[0]== 'D' && locationAbbrev[1]>='0' && locationAbbrev[1]<('0' + TRAIL_SIZE)){
-                    int doubleBacks[5] = {DOUBLE_BACK_1, DOUBLE_BACK_2, DOUBLE_BACK_3, DOUBLE_BACK_4, DOUBLE_BACK_5};
-                    int doubleBackNum = locationAbbrev[1] - '1';
-                    trail[trailCounter] = doubleBacks[doubleBackNum];
-                }
-            }
-            trailCounter ++;
-        }
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        trail[i] = playerTrail[i];
     }
-
 }
 
-//// Functions that query the map to find information about connectivity
-
-// Returns an array of LocationIDs for all directly connected locations
-
-LocationID *connectedLocations(GameView currentView, int *numLocations,
-                               LocationID from, PlayerID player, Round round,
-                               int road, int rail, int sea)
+// Fills the trail array with the locations the player was actually at
+void getLocationHistory(GameView currentView, PlayerID player,
+                        LocationID trail[TRAIL_SIZE])
 {
-    //find max rail connections allowed
-    int maxRailConnections = 0;
-
     if (player != PLAYER_DRACULA){
-        maxRailConnections = (player + getRound(currentView)) % 4;
+        getHistory(currentView, player, trail);
+        return;
     }
-
-    connectionList roadConnections;
-    connectionList seaConnections;
-    connectionList railConnections;
-    //find connections
-    if (road == TRUE) {
-        roadConnections = getConnections(currentView->map, from, ROAD);
-    } else {
-        roadConnections.numConnections = 0;
-        roadConnections.connections = NULL;
-    }
-    if (sea == TRUE) {
-        seaConnections = getConnections(currentView->map, from, BOAT);
-    } else {
-        seaConnections.numConnections = 0;
-        seaConnections.connections = NULL;
-    }
-    if (rail == TRUE && maxRailConnections > 0){
-        railConnections = getConnections(currentView->map, from, RAIL);
-        if (maxRailConnections > 1){
-            //add more rails!!
-            int railIndex;
-            int numRailConnections = railConnections.numConnections;
-            for (railIndex=0; railIndex<numRailConnections; railIndex++){
-                LocationID fromRail = railConnections.connections[railIndex];
-                connectionList newRailConnections = getConnections(currentView->map, fromRail, RAIL);
-                railConnections = mergeConnectionLists(railConnections, newRailConnections);
-            }
-        }
-        if (maxRailConnections > 2){
-            //add more rails!!
-            int railIndex;
-            int numRailConnections = railConnections.numConnections;
-            for (railIndex=0; railIndex<numRailConnections; railIndex++){
-                LocationID fromRail = railConnections.connections[railIndex];
-                connectionList newRailConnections = getConnections(currentView->map, fromRail, RAIL);
-                railConnections = mergeConnectionLists(railConnections, newRailConnections);
-            }
-        }
-    }  else {
-        railConnections.numConnections = 0;
-        railConnections.connections = NULL;
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        trail[i] = currentView->dracula.where[i];
     }
+}
 
-    //reduce this list to unique locations :D need to remove Paris from this list...
-    railConnections = getUniqueLocations(railConnections, from, player);
-
-    //get unique locations array, remove any travel back to same, update numConnections...
-    connectionList uniqueLocations = mergeConnectionLists(roadConnections, seaConnections);
-    uniqueLocations = mergeConnectionLists(uniqueLocations, railConnections);
-    uniqueLocations = getUniqueLocations(uniqueLocations, from, player);
-
-    int totalConnections = uniqueLocations.numConnections;
-    *numLocations = totalConnections;
-
-    LocationID *locations = malloc(sizeof(LocationID)*totalConnections);
-    //add all connection details to array.
-    int index = 0;
-    for (index=0; index < totalConnections; index++){
-        locations[index] = uniqueLocations.connections[index];
+//// Functions that query the map to find information about connectivity
 
+// Returns the set of locations directly connected to from (none if from
+// isn't a place on the map)
+LocationSet connectedLocationSet(GameView currentView, LocationID from,
+                                 PlayerID player, Round round,
+                                 int road, int rail, int sea)
+{
+    if (!validPlace(from)){
+        return setEmpty();
     }
-    return locations;
-}
-
-static connectionList getUniqueLocations(connectionList list, LocationID origin, PlayerID player){
-    int numUnique = 0;
-    int index, location, arrayCount;
-    //bit array, TRUE if location connected, 0 if not.
-    int uniqueArray[NUM_MAP_LOCATIONS] = {0};
-    for (index=0; index<list.numConnections; index++){
-        uniqueArray[list.connections[index]] = TRUE;
+    //the destination 'from' is always included
+    LocationSet reachable = setOf(from);
+    if (road == TRUE){
+        reachable = setUnion(reachable, connectionSet(currentView->map, from, ROAD));
     }
-    //include destination 'from' in array
-    uniqueArray[origin] = TRUE;
-    //remove hospital for Dracula
-    if (player == PLAYER_DRACULA){
-        uniqueArray[ST_JOSEPH_AND_ST_MARYS] = FALSE;
+    if (sea == TRUE){
+        reachable = setUnion(reachable, connectionSet(currentView->map, from, BOAT));
     }
-    //count unique connections
-    for (location=0; location<NUM_MAP_LOCATIONS; location++){
-        if (uniqueArray[location] == TRUE){
-            numUnique ++;
-        }
+    //how many stops a hunter may go by rail depends on the round
+    if (rail == TRUE && player != PLAYER_DRACULA){
+        int maxRailConnections = (player + round) % 4;
+        reachable = setUnion(reachable, railReachable(currentView->map, from, maxRailConnections));
     }
 
-    //return in connectionList
-    connectionList uniqueConnectionList;
-    uniqueConnectionList.numConnections = numUnique;
-    uniqueConnectionList.connections = malloc(sizeof(LocationID)*numUnique);
-    arrayCount = 0;
-    for (location=0; location<NUM_MAP_LOCATIONS; location++){
-        if (uniqueArray[location] == TRUE){
-            uniqueConnectionList.connections[arrayCount] = location;
-            arrayCount ++;
-        }
+    //Dracula can't go to the hospital
+    if (player == PLAYER_DRACULA){
+        setRemove(&reachable, ST_JOSEPH_AND_ST_MARYS);
     }
-    return uniqueConnectionList;
+    return reachable;
 }
 
-static connectionList mergeConnectionLists(connectionList oldList, connectionList newList){
-    connectionList newConnectionList;
+// Returns an array of LocationIDs for all directly connected locations
+LocationID *connectedLocations(GameView currentView, int *numLocations,
+                               LocationID from, PlayerID player, Round round,
+                               int road, int rail, int sea)
+{
+    LocationID buffer[NUM_MAP_LOCATIONS];
+    *numLocations = connectedLocationsInto(currentView, buffer, from, player,
+                                           round, road, rail, sea);
+    return copyLocations(buffer, *numLocations);
+}
 
-    newConnectionList.numConnections = oldList.numConnections + newList.numConnections;
-    newConnectionList.connections = malloc(sizeof(LocationID)*newConnectionList.numConnections);
+// Copies the first numLocations locations into a new malloc'd array
+LocationID *copyLocations(LocationID *locations, int numLocations)
+{
+    LocationID *copy = malloc(sizeof(LocationID)*numLocations);
+    assert(numLocations == 0 || copy != NULL);
+    memcpy(copy, locations, sizeof(LocationID)*numLocations);
+    return copy;
+}
 
-    int index=0, oldIndex, newIndex;
-    for (oldIndex=0; oldIndex < oldList.numConnections; oldIndex++){
-        newConnectionList.connections[index] = oldList.connections[oldIndex];
-        index ++;
-    }
-    for (newIndex=0; newIndex < newList.numConnections; newIndex++){
-        newConnectionList.connections[index] = newList.connections[newIndex];
-        index ++;
-    }
+// Fills locations with all directly connected locations, returns how many
+int connectedLocationsInto(GameView currentView,
+                           LocationID locations[NUM_MAP_LOCATIONS],
+                           LocationID from, PlayerID player, Round round,
+                           int road, int rail, int sea)
+{
+    LocationSet reachable = connectedLocationSet(currentView, from, player,
+                                                 round, road, rail, sea);
+    return setToArray(reachable, locations);
+}
 
-    return newConnectionList;
+// Fills moves with every move Dracula could make next, returns how many
+int legalDraculaMoves(GameView currentView, LocationID moves[MAX_DRACULA_MOVES],
+                      int road, int sea)
+{
+    GameState state;
+    getGameState(currentView, &state);
+    return draculaMoves(&state, moves, road, sea);
 }
 
-static int hospitalVisits(GameView currentView, PlayerID player){
-    int hospitalStays = 0;
-    int index;
-    char locationAbbrev[2];
-    for (index = (int)player * (PLAY_STRING_LENGTH+1);
-         index < strlen(currentView->playRecord); index += (PLAY_STRING_LENGTH+1)*NUM_PLAYERS){
-        locationAbbrev[0] = currentView->playRecord[index+1];
-        locationAbbrev[1] = currentView->playRecord[index+2];
-        LocationID location = abbrevToID(locationAbbrev);
-        if (location == ST_JOSEPH_AND_ST_MARYS){
-            hospitalStays ++;
-        }
+// Writes the current state of the game into state
+void getGameState(GameView currentView, GameState *state)
+{
+    initGameState(state);
+    state->score = currentView->score;
+    state->round = currentView->round;
+    state->curr = currentView->curr;
+    state->draculaHealth = currentView->dracula.health;
+    int i;
+    for (i = 0; i < NUM_HUNTERS; i++){
+        state->health[i] = currentView->hunters[i].health;
+        state->location[i] = currentView->hunters[i].location;
+    }
+    //oldest move first, so each one shifts the earlier ones along
+    Dracula *dracula = &currentView->dracula;
+    state->trailMoves = 0;
+    state->trailWhere = 0;
+    for (i = TRAIL_SIZE-1; i >= 0; i--){
+        state->trailMoves = (state->trailMoves << 8) | (uint8_t)dracula->trail[i];
+        state->trailWhere = (state->trailWhere << 8) | (uint8_t)dracula->where[i];
+        state->trailMinions = (state->trailMinions << MINION_BITS) |
+                              dracula->traps[i] | (dracula->vampire[i] ? MINION_VAMPIRE : 0);
     }
-    return hospitalStays;
+    state->hash = hashGameState(state);
 }
 
-static int numMaturedVampires(GameView currentView){
-    // [player, loc, loc, trap, immature, trap/vampire matures, ., space]
-    //mature vamp if 'V' in 5 spots after Dracula's ID.
-    int numMatured = 0;
-    int index;
-    for (index = PLAYER_DRACULA*(PLAY_STRING_LENGTH+1);
-         index < strlen(currentView->playRecord); index += ((PLAY_STRING_LENGTH+1)*NUM_PLAYERS)){
-        if (currentView->playRecord[index+5]=='V'){
-            numMatured ++;
-        }
+// Updates the game state for a single play, e.g. "GMN.T.." or "DC?.V.."
+static void processPlay(void *view, const Play *play)
+{
+    GameView gameView = view;
+    assert(play->player == gameView->curr);
+    if (gameView->curr == PLAYER_DRACULA){
+        processDraculaPlay(gameView, play);
+        //score drops by 1 at the end of each of Dracula's turns
+        gameView->score -= SCORE_LOSS_DRACULA_TURN;
+        gameView->round ++;
+        gameView->curr = PLAYER_LORD_GODALMING;
+    } else {
+        processHunterPlay(gameView, &gameView->hunters[gameView->curr], play);
+        gameView->curr ++;
     }
-    return numMatured;
 }
 
-static int trapsEncountered (GameView currentView, PlayerID player){
-    // [player, loc, loc, encounter, encounter, encounter, encounter, space]
-    int numTraps = 0;
-    int index;
-    for (index = (int)player * (PLAY_STRING_LENGTH+1);
-         index < strlen(currentView->playRecord); index += ((PLAY_STRING_LENGTH+1)*NUM_PLAYERS)){
-        int offset;
-        for (offset = 0; offset<MAX_ENCOUNTERS; offset ++){
-            if (currentView->playRecord[index + 3 + offset] == 'T') {
-                numTraps ++;
-            }
+// [player, loc, loc, encounter, encounter, encounter, encounter]
+static void processHunterPlay(GameView gameView, Hunter *hunter, const Play *play)
+{
+    LocationID location = play->move;
+
+    //hunters sent to the hospital are patched up by their next turn
+    if (hunter->health <= 0){
+        hunter->health = GAME_START_HUNTER_LIFE_POINTS;
+    }
+    //gains 3 when rest in a city (in same city for 2 turns)
+    if (location == hunter->location){
+        hunter->health += LIFE_GAIN_REST;
+        if (hunter->health > GAME_START_HUNTER_LIFE_POINTS){
+            hunter->health = GAME_START_HUNTER_LIFE_POINTS;
         }
     }
-    return numTraps;
-}
-
-static int timesDraculaEncountered (GameView currentView, PlayerID player){
-    // [player, loc, loc, encounter, encounter, encounter, encounter, space]
-    int numDracula = 0;
-    int index;
-    for (index = (int)player * (PLAY_STRING_LENGTH+1);
-         index < strlen(currentView->playRecord); index += ((PLAY_STRING_LENGTH+1)*NUM_PLAYERS)){
-        int offset;
-        for (offset = 0; offset<MAX_ENCOUNTERS; offset ++){
-            if (currentView->playRecord[index + 3 + offset] == 'D') {
-                numDracula ++;
+    pushTrail(hunter->trail, location);
+    hunter->location = location;
+
+    Dracula *dracula = &gameView->dracula;
+    int offset, i;
+    for (offset = 0; offset < ENCOUNTER_SLOTS && hunter->health > 0; offset ++){
+        if (hasEncounter(play, ENCOUNTER_TRAP, offset)){
+            hunter->health -= LIFE_LOSS_TRAP_ENCOUNTER;
+            for (i = 0; i < TRAIL_SIZE; i++){
+                if (dracula->where[i] == location && dracula->traps[i] > 0){
+                    dracula->traps[i] --;
+                    break;
+                }
+            }
+        } else if (hasEncounter(play, ENCOUNTER_VAMPIRE, offset)){
+            for (i = 0; i < TRAIL_SIZE; i++){
+                if (dracula->where[i] == location){
+                    dracula->vampire[i] = FALSE;
+                }
             }
+        } else if (hasEncounter(play, ENCOUNTER_DRACULA, offset)){
+            hunter->health -= LIFE_LOSS_DRACULA_ENCOUNTER;
+            dracula->health -= LIFE_LOSS_HUNTER_ENCOUNTER;
         }
     }
-    return numDracula;
-}
 
-static int turnsHunterRested(GameView currentView, PlayerID player){
-    int timesRested = 0;
-    int index = (int)player * (PLAY_STRING_LENGTH+1);
-    char locationAbbrev[2];
-    LocationID lastLocation;
-    //get the first location
-    locationAbbrev[0] = currentView->playRecord[index+1];
-    locationAbbrev[1] = currentView->playRecord[index+2];
-    lastLocation = abbrevToID(locationAbbrev);
-    //get the next location and compare
-    for (index = (index + (PLAY_STRING_LENGTH+1)*NUM_PLAYERS);
-         index < strlen(currentView->playRecord); index += (PLAY_STRING_LENGTH+1)*NUM_PLAYERS){
-        locationAbbrev[0] = currentView->playRecord[index+1];
-        locationAbbrev[1] = currentView->playRecord[index+2];
-        LocationID location = abbrevToID(locationAbbrev);
-        if (location == lastLocation){
-            timesRested ++;
-        }
-        lastLocation = location;
+    //hunters with no life points left are teleported to the hospital
+    if (hunter->health <= 0){
+        hunter->health = 0;
+        hunter->deaths ++;
+        hunter->location = ST_JOSEPH_AND_ST_MARYS;
+        gameView->score -= SCORE_LOSS_HUNTER_HOSPITAL;
     }
-    return timesRested;
 }
 
-static int turnsDracAtSea(GameView currentView){
-    int turnsAtSea = 0;
-    int index;
-    char locationAbbrev[2];
-    for (index = PLAYER_DRACULA * (PLAY_STRING_LENGTH+1);
-         index < strlen(currentView->playRecord); index += (PLAY_STRING_LENGTH+1)*NUM_PLAYERS){
-        locationAbbrev[0] = currentView->playRecord[index+1];
-        locationAbbrev[1] = currentView->playRecord[index+2];
-        LocationID location = abbrevToID(locationAbbrev);
-        //if doubled back
-        if (locationAbbrev[0]== 'D' && locationAbbrev[1]>='0' && locationAbbrev[1]<('0' + TRAIL_SIZE)){
-            int movesBack = locationAbbrev[1] - '0';
-            int moveIndex = index - (PLAY_STRING_LENGTH+1)*NUM_PLAYERS*movesBack;
-            locationAbbrev[0] = currentView->playRecord[moveIndex+1];
-            locationAbbrev[1] = currentView->playRecord[moveIndex+2];
-            location = abbrevToID(locationAbbrev);
-        }
-        //if turn was at sea
-        if (location != NOWHERE && idToType(location) == SEA){
-            turnsAtSea ++;
-        } else if (strncmp(locationAbbrev, "S?", 2) == 0){
-            turnsAtSea ++;
-        }
+// [player, loc, loc, trap, immature, trap/vampire matures, .]
+static void processDraculaPlay(GameView gameView, const Play *play)
+{
+    Dracula *dracula = &gameView->dracula;
+    LocationID move = play->move;
+    LocationID where = moveDestination(dracula->where, move);
+
+    //the oldest move leaves the trail, a vampire still there matures
+    if (hasEncounter(play, ENCOUNTER_VAMPIRE, 2)){
+        gameView->score -= SCORE_LOSS_VAMPIRE_MATURES;
+    }
+    int i;
+    for (i = TRAIL_SIZE-1; i > 0; i--){
+        dracula->where[i] = dracula->where[i-1];
+        dracula->traps[i] = dracula->traps[i-1];
+        dracula->vampire[i] = dracula->vampire[i-1];
+    }
+    pushTrail(dracula->trail, move);
+    dracula->where[0] = where;
+    dracula->traps[0] = hasEncounter(play, ENCOUNTER_TRAP, 0);
+    dracula->vampire[0] = hasEncounter(play, ENCOUNTER_VAMPIRE, 1);
+
+    //loses 2 each turn at sea
+    if (where == SEA_UNKNOWN || (validPlace(where) && idToType(where) == SEA)){
+        dracula->health -= LIFE_LOSS_SEA;
+    }
+    //gains 10 if in Castle Dracula at end of turn
+    if (where == CASTLE_DRACULA){
+        dracula->health += LIFE_GAIN_CASTLE_DRACULA;
     }
-    return turnsAtSea;
 }
 
-static int turnsDracAtCastleDrac(GameView currentView){
-    int castleDracStays = 0;
-    int index;
-    char locationAbbrev[2];
-    for (index = PLAYER_DRACULA * (PLAY_STRING_LENGTH+1);
-         index < strlen(currentView->playRecord); index += (PLAY_STRING_LENGTH+1)*NUM_PLAYERS){
-        locationAbbrev[0] = currentView->playRecord[index+1];
-        locationAbbrev[1] = currentView->playRecord[index+2];
-        LocationID location = abbrevToID(locationAbbrev);
-        if (location == CASTLE_DRACULA){
-            castleDracStays ++;
-        }
+// Shifts the trail along one and puts location at the front
+static void pushTrail(LocationID trail[TRAIL_SIZE], LocationID location)
+{
+    int i;
+    for (i = TRAIL_SIZE-1; i > 0; i--){
+        trail[i] = trail[i-1];
     }
-    return castleDracStays;
+    trail[0] = location;
 }
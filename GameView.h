@@ -8,6 +8,8 @@
 #include "Globals.h"
 #include "Game.h"
 #include "Places.h"
+#include "LocationSet.h"
+#include "GameState.h"
 
 typedef struct gameView *GameView;
 
@@ -28,6 +30,19 @@ typedef struct gameView *GameView;
 GameView newGameView(char *pastPlays, PlayerMessage messages[]);
 
 
+// gameViewAppend() updates the game view with plays made since it was
+// created (or last appended to), without re-reading the earlier ones.
+//
+// newPlays holds only the new plays, in the same format as pastPlays
+// (a leading or trailing space is fine). messages holds one entry for
+// each of the new plays.
+//
+// Appending the plays of a pastPlays string in any number of pieces gives
+// the same view as passing the whole string to newGameView().
+
+void gameViewAppend(GameView currentView, char *newPlays, PlayerMessage messages[]);
+
+
 // disposeGameView() frees all memory previously allocated for the GameView
 // toBeDeleted. toBeDeleted should not be accessed after the call.
 
@@ -79,6 +94,24 @@ int getHealth(GameView currentView, PlayerID player);
 
 LocationID getLocation(GameView currentView, PlayerID player);
 
+// Find out what minions Dracula has placed at the specified location
+//   (minions are traps and immature vampires)
+// Only locations that can be identified from pastPlays are counted, so
+//   minions left at CITY_UNKNOWN are invisible until Dracula is revealed
+// If where is at sea or NOWHERE, both counts are set to zero
+
+void getMinions(GameView currentView, LocationID where,
+                int *numTraps, int *numVamps);
+
+
+// Find out what minions Dracula left with the move he made trailIndex
+//   moves ago (0 is his latest move, TRAIL_SIZE-1 the oldest still in
+//   his trail), wherever that was
+// These leave the game with that move: traps are discarded and an
+//   immature vampire matures
+
+void getTrailMinions(GameView currentView, int trailIndex,
+                     int *numTraps, int *numVamps);
 
 //// Functions that return information about the history of the game
 
@@ -104,6 +137,13 @@ LocationID getLocation(GameView currentView, PlayerID player);
 void getHistory(GameView currentView, PlayerID player,
                  LocationID trail[TRAIL_SIZE]);
 
+// Same as getHistory(), except that Dracula's HIDE, DOUBLE_BACK_N and
+//   TELEPORT moves are replaced by the location that move took him to
+// Moves that pastPlays doesn't reveal are still CITY_UNKNOWN or SEA_UNKNOWN
+
+void getLocationHistory(GameView currentView, PlayerID player,
+                        LocationID trail[TRAIL_SIZE]);
+
 
 //// Functions that query the map to find information about connectivity
 
@@ -122,4 +162,53 @@ LocationID *connectedLocations(GameView currentView, int *numLocations,
                                LocationID from, PlayerID player, Round round,
                                int road, int rail, int sea);
 
+// connectedLocationsInto() is connectedLocations() writing into an array
+//   the caller provides (e.g. on the stack), returning the number of
+//   locations written. Nothing is allocated.
+
+int connectedLocationsInto(GameView currentView,
+                           LocationID locations[NUM_MAP_LOCATIONS],
+                           LocationID from, PlayerID player, Round round,
+                           int road, int rail, int sea);
+
+// copyLocations() returns a malloc'd copy of the first numLocations of
+//   locations (e.g. from one of the *Into functions), for the caller to free
+
+LocationID *copyLocations(LocationID *locations, int numLocations);
+
+// connectedLocationSet() is connectedLocations() returning a LocationSet,
+//   which needs no memory allocated or freed
+// Both give no locations if from isn't a place on the map (e.g. the
+//   player's location is still unknown)
+
+LocationSet connectedLocationSet(GameView currentView, LocationID from,
+                                 PlayerID player, Round round,
+                                 int road, int rail, int sea);
+
+// legalDraculaMoves() fills moves with every move Dracula could make
+//   next and returns how many there are. Each move is one of:
+//   a location in [0...70] he can move to normally (road or sea,
+//     never the hospital or a location in his trail)
+//   HIDE             if he can stay where he is (not at sea, no HIDE
+//                    in his trail)
+//   DOUBLE_BACK_N    for each adjacent location N moves back in his
+//                    trail, if there's no double back in his trail yet
+//                    (DOUBLE_BACK_1 means staying where he is)
+//   TELEPORT         only if there is no other move
+// road and sea connections are only considered if road, sea are TRUE.
+// Before his first move, every location but the hospital is returned.
+// Needs to know where Dracula really is, so it returns 0 if his current
+//   location can't be determined from pastPlays (e.g. for hunters)
+
+int legalDraculaMoves(GameView currentView, LocationID moves[MAX_DRACULA_MOVES],
+                      int road, int sea);
+
+// getGameState() writes the current state of the game into state, so
+//   moves can be tried from it with applyMove() (see GameState.h)
+// Only what pastPlays reveals is known: for hunters Dracula's trail
+//   holds CITY_UNKNOWN and SEA_UNKNOWN, and the minions he left there
+//   are missing.
+
+void getGameState(GameView currentView, GameState *state);
+
 #endif
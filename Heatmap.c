@@ -0,0 +1,267 @@
+// Heatmap.c ... how likely the hunters think each place is to be Dracula's
+
+#include <stdint.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "Places.h"
+#include "LocationSet.h"
+#include "Random.h"
+#include "Plays.h"
+#include "Belief.h"
+#include "Heatmap.h"
+
+#define MAX_EDGES   (NUM_MAP_LOCATIONS*NUM_MAP_LOCATIONS)
+
+// Dracula's moves by road or sea, as compressed rows: the places next to
+// v are next[first[v]] .. next[first[v+1]-1]. Moves go both ways, so a
+// row lists both where v can be reached from and where it leads.
+static int     first[HEAT_SIZE+1];
+static uint8_t next[MAX_EDGES];
+static float   evenPrior[HEAT_SIZE];     // 1 everywhere but the hospital
+static float   evenShare[HEAT_SIZE];     // 1 / how many places v leads to
+static pthread_once_t tablesMade = PTHREAD_ONCE_INIT;
+
+static void makeTables(void);
+static void spread(const float *from, float *to, const float *prior);
+static void scaleTo(float *p, LocationSet possible);
+static void makeAlias(Heatmap *heat);
+static void copyHeat(float *to, const float *from);
+static void visitPlay(void *arg, const Play *play);
+
+// what heatAppend() updates with each play
+typedef struct appending {
+    Heatmap     *heat;
+    Belief      *belief;
+    const float *prior;
+} Appending;
+static float sumHeat(const float *p);
+
+void initHeatmap(Heatmap *heat)
+{
+    pthread_once(&tablesMade, makeTables);
+    int i, v;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        for (v = 0; v < HEAT_SIZE; v++){
+            heat->where[i][v] = 0;
+        }
+    }
+    makeAlias(heat);
+}
+
+// updates the heatmap and belief with plays from a pastPlays string
+void heatAppend(Heatmap *heat, Belief *belief, char *plays, const float *prior)
+{
+    Appending appending = {heat, belief, prior};
+    forEachPlay(plays, visitPlay, &appending);
+}
+
+static void visitPlay(void *arg, const Play *play)
+{
+    Appending *appending = arg;
+    beliefPlay(appending->belief, play);
+    heatPlay(appending->heat, appending->belief, play, appending->prior);
+}
+
+// updates the heatmap with one play, given the belief after it
+void heatPlay(Heatmap *heat, const Belief *belief, const Play *play,
+              const float *prior)
+{
+    if (play->player == PLAYER_DRACULA){
+        heatDraculaMove(heat, play->move, prior, beliefWhere(belief));
+    } else if (sumHeat(heat->where[0]) > 0){
+        heatObserve(heat, beliefWhere(belief));
+    }
+}
+
+// Dracula made move, then the belief narrowed him to possible
+void heatDraculaMove(Heatmap *heat, LocationID move, const float *prior,
+                     LocationSet possible)
+{
+    pthread_once(&tablesMade, makeTables);
+    int i;
+    for (i = TRAIL_SIZE-1; i > 0; i--){
+        copyHeat(heat->where[i], heat->where[i-1]);
+    }
+    float *now = heat->where[0];
+    if (move == CITY_UNKNOWN || move == SEA_UNKNOWN){
+        if (sumHeat(heat->where[1]) > 0){
+            spread(heat->where[1], now, prior);
+        } else {
+            //his first move: anywhere, as likely as the prior says
+            copyHeat(now, prior != NULL ? prior : evenPrior);
+        }
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+        copyHeat(now, heat->where[move - DOUBLE_BACK_1 + 1]);
+    } else if (move != HIDE){
+        //a place, or TELEPORT: the belief has it as the only place
+        int v;
+        for (v = 0; v < HEAT_SIZE; v++){
+            now[v] = 1;
+        }
+    }
+    scaleTo(now, possible);
+    makeAlias(heat);
+}
+
+// the hunters learnt that Dracula can only be somewhere in possible
+void heatObserve(Heatmap *heat, LocationSet possible)
+{
+    scaleTo(heat->where[0], possible);
+    makeAlias(heat);
+}
+
+const float *heatWhere(const Heatmap *heat)
+{
+    return heat->where[0];
+}
+
+// picks a slot evenly, then it or its alias
+LocationID heatSample(const Heatmap *heat, uint64_t *random)
+{
+    uint64_t r = randomNext(random);
+    int slot = (int)(((r >> 32) * (uint64_t)NUM_MAP_LOCATIONS) >> 32);
+    float chance = (float)(r & 0xFFFFFF) / (float)0x1000000;
+    return chance < heat->aliasChance[slot] ? slot : heat->alias[slot];
+}
+
+// the rows from Dracula's reach (see Belief.h), without staying put
+static void makeTables(void)
+{
+    int edges = 0;
+    LocationID v;
+    for (v = 0; v < HEAT_SIZE; v++){
+        first[v] = edges;
+        evenPrior[v] = 0;
+        evenShare[v] = 0;
+        if (v >= NUM_MAP_LOCATIONS || v == ST_JOSEPH_AND_ST_MARYS){
+            continue;
+        }
+        evenPrior[v] = 1;
+        LocationSet leads = draculaReach(v);
+        setRemove(&leads, v);
+        evenShare[v] = 1.0f / setSize(leads);
+        while (!setIsEmpty(leads)){
+            next[edges++] = setPopFirst(&leads);
+        }
+    }
+    first[HEAT_SIZE] = edges;
+}
+
+// to[u] = prior[u] * sum over v next to u of from[v] / (the prior of the
+// places v leads to, added up): each place's probability shared out
+// among the places it leads to, in proportion to their prior
+static void spread(const float *from, float *to, const float *prior)
+{
+    float share[HEAT_SIZE] __attribute__((aligned(32)));
+    int u, e;
+    if (prior == NULL){
+        for (u = 0; u < HEAT_SIZE; u++){
+            share[u] = from[u] * evenShare[u];
+        }
+    } else {
+        for (u = 0; u < HEAT_SIZE; u++){
+            float total = 0;
+            for (e = first[u]; e < first[u+1]; e++){
+                total += prior[next[e]];
+            }
+            share[u] = total > 0 ? from[u] / total : 0;
+        }
+    }
+    for (u = 0; u < HEAT_SIZE; u++){
+        float sum = 0;
+        for (e = first[u]; e < first[u+1]; e++){
+            sum += share[next[e]];
+        }
+        to[u] = sum;
+    }
+    const float *weight = prior != NULL ? prior : evenPrior;
+    for (u = 0; u < HEAT_SIZE; u++){
+        to[u] *= weight[u];
+    }
+}
+
+// keeps only the places in possible and scales them to add up to 1 (or
+// if none of them had any chance, which an unlikely prior can do, makes
+// them all as likely)
+static void scaleTo(float *p, LocationSet possible)
+{
+    float mask[HEAT_SIZE] __attribute__((aligned(32)));
+    int v;
+    for (v = 0; v < HEAT_SIZE; v++){
+        mask[v] = setHas(possible, v) ? 1.0f : 0.0f;
+    }
+    for (v = 0; v < HEAT_SIZE; v++){
+        p[v] *= mask[v];
+    }
+    float total = sumHeat(p);
+    if (total <= 0){
+        copyHeat(p, mask);
+        total = sumHeat(p);
+    }
+    if (total > 0){
+        float scale = 1 / total;
+        for (v = 0; v < HEAT_SIZE; v++){
+            p[v] *= scale;
+        }
+    }
+}
+
+// Vose's alias method: each place gets an even slot, and the places with
+// less than their slot's worth top it up from one with more
+static void makeAlias(Heatmap *heat)
+{
+    const float *p = heat->where[0];
+    int8_t small[NUM_MAP_LOCATIONS], large[NUM_MAP_LOCATIONS];
+    float scaled[NUM_MAP_LOCATIONS];
+    int numSmall = 0, numLarge = 0, v;
+    for (v = 0; v < NUM_MAP_LOCATIONS; v++){
+        scaled[v] = p[v] * NUM_MAP_LOCATIONS;
+        heat->alias[v] = v;
+        if (scaled[v] < 1){
+            small[numSmall++] = v;
+        } else {
+            large[numLarge++] = v;
+        }
+    }
+    while (numSmall > 0 && numLarge > 0){
+        int less = small[--numSmall];
+        int more = large[numLarge-1];
+        heat->aliasChance[less] = scaled[less];
+        heat->alias[less] = more;
+        scaled[more] -= 1 - scaled[less];
+        if (scaled[more] < 1){
+            numLarge --;
+            small[numSmall++] = more;
+        }
+    }
+    //what's left is a whole slot's worth, give or take rounding
+    while (numLarge > 0){
+        heat->aliasChance[large[--numLarge]] = 1;
+    }
+    while (numSmall > 0){
+        v = small[--numSmall];
+        heat->aliasChance[v] = scaled[v] > 0 ? 1 : 0;
+    }
+    for (v = NUM_MAP_LOCATIONS; v < HEAT_SIZE; v++){
+        heat->aliasChance[v] = 0;
+        heat->alias[v] = 0;
+    }
+}
+
+static void copyHeat(float *to, const float *from)
+{
+    int v;
+    for (v = 0; v < HEAT_SIZE; v++){
+        to[v] = from[v];
+    }
+}
+
+static float sumHeat(const float *p)
+{
+    float total = 0;
+    int v;
+    for (v = 0; v < HEAT_SIZE; v++){
+        total += p[v];
+    }
+    return total;
+}
@@ -0,0 +1,78 @@
+// Heatmap.h ... how likely the hunters think each place is to be Dracula's
+//
+// A Belief (see Belief.h) says where Dracula could be; a Heatmap says
+// how likely each of those places is. It holds a probability for each
+// place for each move of his trail, the first being where he is now,
+// and moves it along with him a play at a time:
+//
+//   - for a C? or S? each place shares out its probability among the
+//     places he can move to from it by road or sea (all alike, or in
+//     proportion to a prior weight for each place), which is a sparse
+//     matrix-vector product over the map's adjacency lists
+//   - HIDE leaves it where it was, DOUBLE_BACK_n takes it from the move
+//     n back, a revealed place or TELEPORT puts it all in one place
+//
+// and after every play it keeps only the places the Belief still
+// allows and scales the rest to add up to 1 (Bayes' rule, with
+// everything a hunter finds or doesn't find taken from the Belief).
+//
+// Reading a probability is an array look-up, and after each update an
+// alias table is built so that a place can be drawn from the heatmap
+// in constant time, however many times a search wants one.
+
+#ifndef HEATMAP_H
+#define HEATMAP_H
+
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "LocationSet.h"
+#include "Plays.h"
+#include "Belief.h"
+
+// the probability arrays are padded to a multiple of 8 floats, so whole
+// vector registers can work along them (the padding is always 0)
+#define HEAT_SIZE   72
+
+typedef struct heatmap {
+    float   where[TRAIL_SIZE][HEAT_SIZE];  // each trail move, latest first
+    float   aliasChance[HEAT_SIZE];        // alias table for where[0]
+    int8_t  alias[HEAT_SIZE];
+} Heatmap;
+
+// nothing known: before Dracula's first move
+
+void initHeatmap(Heatmap *heat);
+
+// updates the heatmap and belief with plays from a pastPlays string (see
+// gameViewAppend() in GameView.h for the format); prior, if not NULL,
+// weights each place Dracula might move to (HEAT_SIZE weights, >= 0)
+
+void heatAppend(Heatmap *heat, Belief *belief, char *plays, const float *prior);
+
+// updates the heatmap with one play, given the belief after it
+
+void heatPlay(Heatmap *heat, const Belief *belief, const Play *play,
+              const float *prior);
+
+// Dracula made move, as the hunters see it (see beliefDraculaMove()),
+// then the belief narrowed where he could be to possible
+
+void heatDraculaMove(Heatmap *heat, LocationID move, const float *prior,
+                     LocationSet possible);
+
+// the hunters learnt that Dracula can only be somewhere in possible
+
+void heatObserve(Heatmap *heat, LocationSet possible);
+
+// the probability of each place (HEAT_SIZE of them) being where Dracula
+// is now; points into heat
+
+const float *heatWhere(const Heatmap *heat);
+
+// a place drawn at random from where Dracula is now, as likely as the
+// heatmap says; random is the caller's xorshift64* state (never 0)
+
+LocationID heatSample(const Heatmap *heat, uint64_t *random);
+
+#endif
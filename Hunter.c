@@ -0,0 +1,33 @@
+// Hunter.c ... the hunters' player
+//
+// The search and its threads last from one turn to the next, so each
+// turn picks up the tree from the last and the threads search on while
+// the other players move.
+
+#include <stdlib.h>
+#include "Globals.h"
+#include "Game.h"
+#include "HunterView.h"
+#include "Hunter.h"
+#include "ThreadPool.h"
+#include "TimeBudget.h"
+#include "Mcts.h"
+
+#define SEARCH_NODES   (1 << 20)
+
+static ThreadPool pool = NULL;
+static Mcts mcts = NULL;
+
+// Searches for the best move for as long as the engine allows, then
+// carries on searching from after it until the next turn
+void decideHunterMove(HunterView gameState)
+{
+    if (mcts == NULL){
+        unsigned int seed = giveMeTheRound(gameState)*NUM_PLAYERS + whoAmI(gameState);
+        pool = newThreadPool(0);   //one thread per core
+        mcts = newMcts(SEARCH_NODES, seed);
+        mctsSetPool(mcts, pool);
+    }
+    LocationID move = mctsHunterMove(mcts, gameState, LIMIT_LIMIT_MSECS - BUDGET_SAFETY_MSECS);
+    mctsPonder(mcts, move);
+}
@@ -0,0 +1,17 @@
+// Hunter.h
+// Interface to the hunters' player
+// The game engine calls decideHunterMove() on each hunter's turn
+
+#ifndef HUNTER_H
+#define HUNTER_H
+
+#include "HunterView.h"
+
+// decideHunterMove() works out the current hunter's move, registering
+// it with registerBestPlay() (and improving on it) until it runs out of
+// time. A move is registered straight away, so the engine can stop it
+// at any point.
+
+void decideHunterMove(HunterView gameState);
+
+#endif
@@ -7,13 +7,32 @@
 #include "GameView.h"
 #include "HunterView.h"
 #include "Map.h"
+#include "Belief.h"
+#include "Heatmap.h"
+#include "ParticleFilter.h"
+#include "Plays.h"
      
 struct hunterView {
     GameView view;
-    LocationID dracTrail[TRAIL_SIZE];
+    Belief belief;
+    Heatmap heat;
+    ParticleFilter particles;
 };
 
 #define FIRST_ROUND 0     
+#define PARTICLE_SEED 1
+// the particles only need the plays of the rounds their trails cover:
+// the ones before are summed up well enough by the belief
+#define PARTICLE_PLAYS (TRAIL_SIZE*NUM_PLAYERS)
+
+static void trackDracula(HunterView hunterView, char *plays, int skipParticles);
+static void trackPlay(void *arg, const Play *play);
+
+// where trackDracula() is up to
+typedef struct tracking {
+    HunterView hunterView;
+    int        skipParticles;   // plays left before the particles start
+} Tracking;
 
 // Creates a new HunterView to summarise the current state of the game
 HunterView newHunterView(char *pastPlays, PlayerMessage messages[])
@@ -23,20 +42,31 @@ HunterView newHunterView(char *pastPlays, PlayerMessage messages[])
     HunterView hunterView = malloc(sizeof(struct hunterView));
     hunterView->view = newGameView(pastPlays, messages);
 
-    int i;
-    for(i = 0; i < TRAIL_SIZE; i++){
-        hunterView->dracTrail[i] = UNKNOWN_LOCATION;
-    }
+    initBelief(&hunterView->belief);
+    initHeatmap(&hunterView->heat);
+    hunterView->particles = newParticleFilter(DEFAULT_PARTICLES, PARTICLE_SEED);
+    int numPlays = countPlays(pastPlays);
+    trackDracula(hunterView, pastPlays,
+                 numPlays > PARTICLE_PLAYS ? numPlays - PARTICLE_PLAYS : 0);
 
     return hunterView;
 }
      
+
+// Brings the HunterView up to date with plays made since it was created
+void hunterViewAppend(HunterView currentView, char *newPlays, PlayerMessage messages[])
+{
+    assert(newPlays != NULL);
+    gameViewAppend(currentView->view, newPlays, messages);
+    trackDracula(currentView, newPlays, 0);
+}
      
 // Frees all memory previously allocated for the HunterView toBeDeleted
 void disposeHunterView(HunterView toBeDeleted)
 {
     assert(toBeDeleted != NULL);
     disposeGameView(toBeDeleted->view);
+    disposeParticleFilter(toBeDeleted->particles);
     free(toBeDeleted);
 }
 
@@ -87,57 +117,117 @@ void giveMeTheTrail(HunterView currentView, PlayerID player,
 // What are my possible next moves (locations)
 LocationID *whereCanIgo(HunterView currentView, int *numLocations,
                         int road, int rail, int sea)
-{   
-    LocationID *iCanGo;
-    PlayerID player = getCurrentPlayer(currentView->view);
-    LocationID from = getLocation(currentView->view, player);
-    Round round = getRound(currentView->view);
-
-    if(getRound(currentView->view) == FIRST_ROUND) {
-        iCanGo = (LocationID *)(malloc(sizeof(LocationID)*NUM_MAP_LOCATIONS));
-        *numLocations = NUM_MAP_LOCATIONS - 1;
-
-        int i;
-        for(i=0; i < NUM_MAP_LOCATIONS ;i++) {
-            iCanGo[*numLocations] = i;
-        }
-    } else {
-        iCanGo = connectedLocations(currentView->view, numLocations, from, player, round, road, rail, sea);
-    }
+{
+    LocationID buffer[NUM_MAP_LOCATIONS];
+    *numLocations = whereCanIgoInto(currentView, buffer, road, rail, sea);
+    return copyLocations(buffer, *numLocations);
+}
 
-    return iCanGo;
+// What are my possible next moves, written into the caller's array
+int whereCanIgoInto(HunterView currentView, LocationID locations[NUM_MAP_LOCATIONS],
+                    int road, int rail, int sea)
+{
+    PlayerID player = getCurrentPlayer(currentView->view);
+    return whereCanTheyGoInto(currentView, locations, player, road, rail, sea);
 }
 
 // What are the specified player's next possible moves
 LocationID *whereCanTheyGo(HunterView currentView, int *numLocations,
                            PlayerID player, int road, int rail, int sea)
 {
-    LocationID *theyCanGo;
-    LocationID from = getLocation(currentView->view, player);
+    LocationID buffer[NUM_MAP_LOCATIONS];
+    *numLocations = whereCanTheyGoInto(currentView, buffer, player, road, rail, sea);
+    return copyLocations(buffer, *numLocations);
+}
+
+// What are the specified player's next possible moves, written into the
+// caller's array
+int whereCanTheyGoInto(HunterView currentView, LocationID locations[NUM_MAP_LOCATIONS],
+                       PlayerID player, int road, int rail, int sea)
+{
+    LocationID trail[TRAIL_SIZE];
     Round nextGo;
 
     // making sure to get the players up coming turn
-    if(player > getCurrentPlayer(currentView->view)) {
+    if(player >= getCurrentPlayer(currentView->view)) {
         nextGo = getRound(currentView->view);
     } else {
         nextGo = getRound(currentView->view) + 1;
     }
 
+    // on their first turn players can start anywhere (but Dracula
+    // never goes to the hospital)
     if(nextGo == FIRST_ROUND) {
-        theyCanGo = (LocationID *)(malloc(sizeof(LocationID)*NUM_MAP_LOCATIONS));
-        *numLocations = NUM_MAP_LOCATIONS - 1;
-
-        int i;
-        for(i=0; i < NUM_MAP_LOCATIONS ;i++) {
-            theyCanGo[*numLocations] = i;
-        }
-    } else {
-        if(player == PLAYER_DRACULA) {
-            theyCanGo = connectedLocations(currentView->view, numLocations, from, player, nextGo, road, FALSE, sea);
-        } else {
-            theyCanGo = connectedLocations(currentView->view, numLocations, from, player, nextGo, road, rail, sea);
+        int i, numLocations = 0;
+        for(i = 0; i < NUM_MAP_LOCATIONS; i++) {
+            if(player != PLAYER_DRACULA || i != ST_JOSEPH_AND_ST_MARYS) {
+                locations[numLocations++] = i;
+            }
         }
+        return numLocations;
     }
 
-    return theyCanGo;
-}
\ No newline at end of file
+    LocationID from = getLocation(currentView->view, player);
+    if(player == PLAYER_DRACULA) {
+        // we can only follow Dracula if we know exactly where he is
+        getLocationHistory(currentView->view, player, trail);
+        from = trail[0];
+        rail = FALSE;
+    }
+    if(!validPlace(from)) {
+        return 0;
+    }
+    return connectedLocationsInto(currentView->view, locations, from,
+                                  player, nextGo, road, rail, sea);
+}
+
+// The state of the game as the hunters know it
+void giveMeTheState(HunterView currentView, GameState *state)
+{
+    getGameState(currentView->view, state);
+}
+
+// Where Dracula could be, from everything the hunters have seen
+LocationSet whereMightDraculaBe(HunterView currentView)
+{
+    return beliefWhere(&currentView->belief);
+}
+
+// Where each move of Dracula's trail could have taken him
+void giveMeTheBelief(HunterView currentView, Belief *belief)
+{
+    *belief = currentView->belief;
+}
+
+// How likely each place is to be where Dracula is
+const Heatmap *giveMeTheHeatmap(HunterView currentView)
+{
+    return &currentView->heat;
+}
+
+// Whole trails Dracula could have taken
+ParticleFilter giveMeTheParticles(HunterView currentView)
+{
+    return currentView->particles;
+}
+
+// updates what the hunters know of Dracula with each play in turn (but
+// the particles only from play skipParticles on)
+static void trackDracula(HunterView hunterView, char *plays, int skipParticles)
+{
+    Tracking tracking = {hunterView, skipParticles};
+    forEachPlay(plays, trackPlay, &tracking);
+}
+
+static void trackPlay(void *arg, const Play *play)
+{
+    Tracking *tracking = arg;
+    HunterView hunterView = tracking->hunterView;
+    beliefPlay(&hunterView->belief, play);
+    heatPlay(&hunterView->heat, &hunterView->belief, play, NULL);
+    if (tracking->skipParticles > 0){
+        tracking->skipParticles --;
+    } else {
+        particlePlay(hunterView->particles, &hunterView->belief, play);
+    }
+}
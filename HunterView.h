@@ -8,6 +8,11 @@
 #include "Globals.h"
 #include "Game.h"
 #include "Places.h"
+#include "GameState.h"
+#include "LocationSet.h"
+#include "Belief.h"
+#include "Heatmap.h"
+#include "ParticleFilter.h"
 
 typedef struct hunterView *HunterView;
 
@@ -32,6 +37,13 @@ typedef struct hunterView *HunterView;
 HunterView newHunterView(char *pastPlays, PlayerMessage messages[]);
 
 
+// hunterViewAppend() updates the view with plays made since it was created
+// (or last appended to), without re-reading the earlier ones.
+// See gameViewAppend() in GameView.h for the format of newPlays.
+
+void hunterViewAppend(HunterView currentView, char *newPlays, PlayerMessage messages[]);
+
+
 // disposeHunterView() frees all memory previously allocated for the HunterView
 // toBeDeleted. toBeDeleted should not be accessed after the call.
 
@@ -100,6 +112,13 @@ void giveMeTheTrail(HunterView currentView, PlayerID player,
 LocationID *whereCanIgo(HunterView currentView, int *numLocations,
                         int road, int rail, int sea);
 
+// whereCanIgoInto() is whereCanIgo() writing into an array the caller
+//   provides (e.g. on the stack), returning the number of locations
+//   written. Nothing is allocated.
+
+int whereCanIgoInto(HunterView currentView, LocationID locations[NUM_MAP_LOCATIONS],
+                    int road, int rail, int sea);
+
 // whereCanTheyGo() returns an array of LocationIDs giving all of the
 //   locations that the given Player could reach from their current location
 // road, rail and sea are connections should only be considered
@@ -113,5 +132,41 @@ LocationID *whereCanIgo(HunterView currentView, int *numLocations,
 LocationID *whereCanTheyGo(HunterView currentView, int *numLocations,
                            PlayerID player, int road, int rail, int sea);
 
+// whereCanTheyGoInto() is whereCanTheyGo() writing into an array the caller
+//   provides, returning the number of locations written
+
+int whereCanTheyGoInto(HunterView currentView, LocationID locations[NUM_MAP_LOCATIONS],
+                       PlayerID player, int road, int rail, int sea);
+
+// giveMeTheState() writes the state of the game as the hunters know it
+//   into state (see getGameState() in GameView.h): Dracula's unrevealed
+//   moves are CITY_UNKNOWN or SEA_UNKNOWN in its trail
+
+void giveMeTheState(HunterView currentView, GameState *state);
+
+// whereMightDraculaBe() returns the set of places Dracula could be now,
+//   given all his moves and every hunter's finding him or not (see
+//   Belief.h); a single place if he has just been seen
+
+LocationSet whereMightDraculaBe(HunterView currentView);
+
+// giveMeTheBelief() copies the hunters' belief about every move of
+//   Dracula's trail into belief
+
+void giveMeTheBelief(HunterView currentView, Belief *belief);
+
+// giveMeTheHeatmap() returns how likely each place is to be where Dracula
+//   is, with every move he could make from a place taken as equally
+//   likely (see Heatmap.h): heatWhere() reads it and heatSample() draws
+//   from it. It belongs to the view and changes when the view does.
+
+const Heatmap *giveMeTheHeatmap(HunterView currentView);
+
+// giveMeTheParticles() returns DEFAULT_PARTICLES whole trails Dracula
+//   could have taken, each fitting everything the hunters have seen
+//   (see ParticleFilter.h): particleSample() and particleGuess() draw
+//   from them. They belong to the view and change when the view does.
+
+ParticleFilter giveMeTheParticles(HunterView currentView);
 
 #endif
@@ -0,0 +1,139 @@
+// LocationSet.h ... sets of map locations as 128-bit masks
+//
+// There are only NUM_MAP_LOCATIONS (71) real places, so a set of them
+// fits in two 64-bit words: location v is bit (v % 64) of word (v / 64).
+// Every operation here is a few word instructions with no allocation,
+// so sets can be passed around and returned by value.
+//
+// Only real places (validPlace) can be stored; special locations such as
+// CITY_UNKNOWN or HIDE have no bit.
+
+#ifndef LOCATION_SET_H
+#define LOCATION_SET_H
+
+#include <stdint.h>
+#include "Places.h"
+
+#define SET_WORDS 2
+
+typedef struct locationSet {
+    uint64_t bits[SET_WORDS];
+} LocationSet;
+
+// the set with nothing in it
+static inline LocationSet setEmpty(void)
+{
+    LocationSet s = {{0, 0}};
+    return s;
+}
+
+// the set of every real place
+static inline LocationSet setAll(void)
+{
+    LocationSet s = {{~(uint64_t)0, ((uint64_t)1 << (NUM_MAP_LOCATIONS - 64)) - 1}};
+    return s;
+}
+
+// the set holding just one location
+static inline LocationSet setOf(LocationID v)
+{
+    LocationSet s = {{0, 0}};
+    s.bits[v >> 6] = (uint64_t)1 << (v & 63);
+    return s;
+}
+
+static inline int setHas(LocationSet s, LocationID v)
+{
+    return (s.bits[v >> 6] >> (v & 63)) & 1;
+}
+
+static inline void setAdd(LocationSet *s, LocationID v)
+{
+    s->bits[v >> 6] |= (uint64_t)1 << (v & 63);
+}
+
+static inline void setRemove(LocationSet *s, LocationID v)
+{
+    s->bits[v >> 6] &= ~((uint64_t)1 << (v & 63));
+}
+
+static inline LocationSet setUnion(LocationSet a, LocationSet b)
+{
+    LocationSet s = {{a.bits[0] | b.bits[0], a.bits[1] | b.bits[1]}};
+    return s;
+}
+
+static inline LocationSet setIntersect(LocationSet a, LocationSet b)
+{
+    LocationSet s = {{a.bits[0] & b.bits[0], a.bits[1] & b.bits[1]}};
+    return s;
+}
+
+// everything in a that isn't in b
+static inline LocationSet setMinus(LocationSet a, LocationSet b)
+{
+    LocationSet s = {{a.bits[0] & ~b.bits[0], a.bits[1] & ~b.bits[1]}};
+    return s;
+}
+
+static inline int setIsEmpty(LocationSet s)
+{
+    return (s.bits[0] | s.bits[1]) == 0;
+}
+
+static inline int setEquals(LocationSet a, LocationSet b)
+{
+    return a.bits[0] == b.bits[0] && a.bits[1] == b.bits[1];
+}
+
+// number of locations in the set
+static inline int setSize(LocationSet s)
+{
+    return __builtin_popcountll(s.bits[0]) + __builtin_popcountll(s.bits[1]);
+}
+
+// lowest-numbered location in the set, or NOWHERE if it is empty
+static inline LocationID setFirst(LocationSet s)
+{
+    if (s.bits[0] != 0) return __builtin_ctzll(s.bits[0]);
+    if (s.bits[1] != 0) return 64 + __builtin_ctzll(s.bits[1]);
+    return NOWHERE;
+}
+
+// removes and returns the lowest-numbered location, for iterating:
+//   while (!setIsEmpty(s)) { LocationID v = setPopFirst(&s); ... }
+static inline LocationID setPopFirst(LocationSet *s)
+{
+    LocationID v = setFirst(*s);
+    if (v != NOWHERE) s->bits[v >> 6] &= s->bits[v >> 6] - 1;
+    return v;
+}
+
+// the location with n others before it in s (n < setSize(s))
+static inline LocationID setNth(LocationSet s, int n)
+{
+    int word = 0;
+    int low = __builtin_popcountll(s.bits[0]);
+    if (n >= low) {
+        n -= low;
+        word = 1;
+    }
+    uint64_t bits = s.bits[word];
+    while (n-- > 0) {
+        bits &= bits - 1;
+    }
+    return word*64 + __builtin_ctzll(bits);
+}
+
+// writes the locations out in increasing order, returns how many
+// (out needs room for setSize(s) locations)
+static inline int setToArray(LocationSet s, LocationID *out)
+{
+    int n = 0;
+    while (!setIsEmpty(s)) {
+        out[n++] = setPopFirst(&s);
+    }
+    return n;
+}
+
+#endif
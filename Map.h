@@ -4,6 +4,7 @@
 #define MAP_H
 
 #include "Places.h"
+#include "LocationSet.h"
 
 typedef struct edge{
     LocationID  start;
@@ -11,11 +12,16 @@ typedef struct edge{
     TransportID type;
 } Edge;
 
+// hunters can go at most this many stops by rail in one move
+#define MAX_RAIL_HOPS 3
+
 // graph representation is hidden 
-typedef struct MapRep *Map;
+// there is only one map, shared and read-only
+typedef const struct MapRep *Map;
 
+// a read-only view of some of a location's neighbours
 typedef struct connectionList{
-    LocationID *connections;
+    const LocationID *connections;
     int numConnections;
 } connectionList;
 
@@ -26,7 +32,14 @@ void showMap(Map g);
 int  numV(Map g);
 int  numE(Map g, TransportID type);
 
-//finds all connections of a specified type, from a specified location
+//finds all connections of a specified type (or ANY), from a specified location
+//the list points into the map, so it must not be changed or freed
 connectionList getConnections(Map g, LocationID locationFrom, TransportID type);
 
+//the same connections as a set of locations
+LocationSet connectionSet(Map g, LocationID locationFrom, TransportID type);
+
+//all stations within hops stops by rail (0...MAX_RAIL_HOPS), including the start
+LocationSet railReachable(Map g, LocationID locationFrom, int hops);
+
 #endif
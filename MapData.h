@@ -0,0 +1,1078 @@
+// MapData.h ... generated by mkMapData, do not edit
+// Initialiser for the struct MapRep in Map.c
+
+   71, // nV
+   { 0, 230, 86, 80, 396 }, // nE by transport type
+   { // first
+      {   0,   0,   0,   0,   3 }, // Adriatic Sea
+      {   0,   3,   6,   8,   9 }, // Alicante
+      {   0,   9,  11,  11,  12 }, // Amsterdam
+      {   0,  12,  13,  13,  14 }, // Athens
+      {   0,  14,  14,  14,  22 }, // Atlantic Ocean
+      {   0,  22,  24,  26,  27 }, // Barcelona
+      {   0,  27,  29,  30,  31 }, // Bari
+      {   0,  31,  31,  31,  35 }, // Bay of Biscay
+      {   0,  35,  41,  43,  43 }, // Belgrade
+      {   0,  43,  46,  49,  49 }, // Berlin
+      {   0,  49,  49,  49,  52 }, // Black Sea
+      {   0,  52,  56,  58,  59 }, // Bordeaux
+      {   0,  59,  64,  66,  66 }, // Brussels
+      {   0,  66,  71,  74,  74 }, // Bucharest
+      {   0,  74,  78,  80,  80 }, // Budapest
+      {   0,  80,  83,  83,  84 }, // Cadiz
+      {   0,  84,  84,  84,  86 }, // Cagliari
+      {   0,  86,  88,  88,  88 }, // Castle Dracula
+      {   0,  88,  94,  94,  94 }, // Clermont-Ferrand
+      {   0,  94, 100, 102, 102 }, // Cologne
+      {   0, 102, 105, 106, 107 }, // Constanta
+      {   0, 107, 108, 108, 109 }, // Dublin
+      {   0, 109, 110, 111, 112 }, // Edinburgh
+      {   0, 112, 112, 112, 117 }, // English Channel
+      {   0, 117, 120, 122, 122 }, // Florence
+      {   0, 122, 126, 129, 129 }, // Frankfurt
+      {   0, 129, 133, 134, 134 }, // Galatz
+      {   0, 134, 135, 135, 136 }, // Galway
+      {   0, 136, 141, 142, 142 }, // Geneva
+      {   0, 142, 146, 147, 148 }, // Genoa
+      {   0, 148, 151, 151, 151 }, // Granada
+      {   0, 151, 154, 155, 156 }, // Hamburg
+      {   0, 156, 156, 156, 162 }, // Ionian Sea
+      {   0, 162, 162, 162, 166 }, // Irish Sea
+      {   0, 166, 172, 172, 172 }, // Klausenburg
+      {   0, 172, 175, 176, 177 }, // Le Havre
+      {   0, 177, 182, 185, 185 }, // Leipzig
+      {   0, 185, 188, 189, 190 }, // Lisbon
+      {   0, 190, 192, 193, 194 }, // Liverpool
+      {   0, 194, 197, 199, 200 }, // London
+      {   0, 200, 206, 210, 210 }, // Madrid
+      {   0, 210, 213, 216, 216 }, // Manchester
+      {   0, 216, 222, 223, 224 }, // Marseilles
+      {   0, 224, 224, 224, 230 }, // Mediterranean Sea
+      {   0, 230, 235, 239, 239 }, // Milan
+      {   0, 239, 246, 247, 247 }, // Munich
+      {   0, 247, 251, 251, 252 }, // Nantes
+      {   0, 252, 254, 256, 257 }, // Naples
+      {   0, 257, 257, 257, 262 }, // North Sea
+      {   0, 262, 267, 269, 269 }, // Nuremburg
+      {   0, 269, 275, 279, 279 }, // Paris
+      {   0, 279, 280, 280, 281 }, // Plymouth
+      {   0, 281, 284, 286, 286 }, // Prague
+      {   0, 286, 289, 291, 292 }, // Rome
+      {   0, 292, 294, 295, 296 }, // Salonica
+      {   0, 296, 299, 300, 301 }, // Santander
+      {   0, 301, 307, 310, 310 }, // Saragossa
+      {   0, 310, 315, 315, 315 }, // Sarajevo
+      {   0, 315, 321, 324, 324 }, // Sofia
+      {   0, 324, 328, 328, 328 }, // St Joseph and St Marys
+      {   0, 328, 336, 338, 338 }, // Strasbourg
+      {   0, 338, 340, 341, 342 }, // Swansea
+      {   0, 342, 347, 350, 350 }, // Szeged
+      {   0, 350, 355, 355, 355 }, // Toulouse
+      {   0, 355, 355, 355, 361 }, // Tyrrhenian Sea
+      {   0, 361, 365, 365, 366 }, // Valona
+      {   0, 366, 368, 369, 370 }, // Varna
+      {   0, 370, 374, 375, 376 }, // Venice
+      {   0, 376, 380, 383, 383 }, // Vienna
+      {   0, 383, 389, 389, 389 }, // Zagreb
+      {   0, 389, 394, 396, 396 }, // Zurich
+   },
+   { // adj
+       6, 32, 67, // Adriatic Sea
+      30, 40, 56,  5, 40, 43, // Alicante
+      12, 19, 48, // Amsterdam
+      65, 32, // Athens
+       7, 15, 23, 27, 33, 37, 43, 48, // Atlantic Ocean
+      56, 63,  1, 56, 43, // Barcelona
+      47, 53, 47,  0, // Bari
+       4, 11, 46, 55, // Bay of Biscay
+      13, 34, 57, 58, 59, 62, 58, 62, // Belgrade
+      31, 36, 52, 31, 36, 52, // Berlin
+      20, 32, 66, // Black Sea
+      18, 46, 56, 63, 50, 56,  7, // Bordeaux
+       2, 19, 35, 50, 60, 19, 50, // Brussels
+       8, 20, 26, 34, 58, 20, 26, 62, // Bucharest
+      34, 62, 68, 69, 62, 68, // Budapest
+      30, 37, 40,  4, // Cadiz
+      43, 64, // Cagliari
+      26, 34, // Castle Dracula
+      11, 28, 42, 46, 50, 63, // Clermont-Ferrand
+       2, 12, 25, 31, 36, 60, 12, 25, // Cologne
+      13, 26, 66, 13, 10, // Constanta
+      27, 33, // Dublin
+      41, 41, 48, // Edinburgh
+       4, 35, 39, 48, 51, // English Channel
+      29, 53, 67, 44, 53, // Florence
+      19, 36, 49, 60, 19, 36, 60, // Frankfurt
+      13, 17, 20, 34, 13, // Galatz
+      21,  4, // Galway
+      18, 42, 50, 60, 70, 44, // Geneva
+      24, 42, 44, 67, 44, 64, // Genoa
+       1, 15, 40, // Granada
+       9, 19, 36,  9, 48, // Hamburg
+       0,  3, 10, 54, 64, 65, // Ionian Sea
+       4, 21, 38, 61, // Irish Sea
+       8, 13, 14, 17, 26, 62, // Klausenburg
+      12, 46, 50, 50, 23, // Le Havre
+       9, 19, 25, 31, 49,  9, 25, 49, // Leipzig
+      15, 40, 55, 40,  4, // Lisbon
+      41, 61, 41, 33, // Liverpool
+      41, 51, 61, 41, 61, 23, // London
+       1, 15, 30, 37, 55, 56,  1, 37, 55, 56, // Madrid
+      22, 38, 39, 22, 38, 39, // Manchester
+      18, 28, 29, 44, 63, 70, 50, 43, // Marseilles
+       1,  4,  5, 16, 42, 64, // Mediterranean Sea
+      29, 42, 45, 67, 70, 24, 28, 29, 70, // Milan
+      44, 49, 60, 67, 68, 69, 70, 49, // Munich
+      11, 18, 35, 50,  7, // Nantes
+       6, 53,  6, 53, 64, // Naples
+       2,  4, 22, 23, 31, // North Sea
+      25, 36, 45, 52, 60, 36, 45, // Nuremburg
+      12, 18, 28, 35, 46, 60, 11, 12, 35, 42, // Paris
+      39, 23, // Plymouth
+       9, 49, 68,  9, 68, // Prague
+       6, 24, 47, 24, 47, 64, // Rome
+      58, 65, 58, 32, // Salonica
+      37, 40, 56, 40,  7, // Santander
+       1,  5, 11, 40, 55, 63,  5, 11, 40, // Saragossa
+       8, 58, 59, 65, 69, // Sarajevo
+       8, 13, 54, 57, 65, 66,  8, 54, 66, // Sofia
+       8, 57, 62, 69, // St Joseph and St Marys
+      12, 19, 25, 28, 45, 49, 50, 70, 25, 70, // Strasbourg
+      38, 39, 39, 33, // Swansea
+       8, 14, 34, 59, 69,  8, 13, 14, // Szeged
+       5, 11, 18, 42, 56, // Toulouse
+      16, 29, 32, 43, 47, 53, // Tyrrhenian Sea
+       3, 54, 57, 58, 32, // Valona
+      20, 58, 58, 10, // Varna
+      24, 29, 44, 45, 68,  0, // Venice
+      14, 45, 52, 69, 14, 52, 67, // Vienna
+      14, 45, 57, 59, 62, 68, // Zagreb
+      28, 42, 44, 45, 60, 44, 60, // Zurich
+   },
+   { // conn
+      { // Adriatic Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000040ULL, 0x0000000000000008ULL }},
+         {{ 0x0000000100000040ULL, 0x0000000000000008ULL }},
+      },
+      { // Alicante
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0100010040000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000010000000020ULL, 0x0000000000000000ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0100090040000020ULL, 0x0000000000000000ULL }},
+      },
+      { // Amsterdam
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000081000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001000000081000ULL, 0x0000000000000000ULL }},
+      },
+      { // Athens
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000002ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000000ULL, 0x0000000000000002ULL }},
+      },
+      { // Atlantic Ocean
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001082208808080ULL, 0x0000000000000000ULL }},
+         {{ 0x0001082208808080ULL, 0x0000000000000000ULL }},
+      },
+      { // Barcelona
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8100000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0100000000000002ULL, 0x0000000000000000ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8100080000000002ULL, 0x0000000000000000ULL }},
+      },
+      { // Bari
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020800000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000800000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000001ULL, 0x0000000000000000ULL }},
+         {{ 0x0020800000000001ULL, 0x0000000000000000ULL }},
+      },
+      { // Bay of Biscay
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0080400000000810ULL, 0x0000000000000000ULL }},
+         {{ 0x0080400000000810ULL, 0x0000000000000000ULL }},
+      },
+      { // Belgrade
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4e00000400002000ULL, 0x0000000000000000ULL }},
+         {{ 0x4400000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4e00000400002000ULL, 0x0000000000000000ULL }},
+      },
+      { // Berlin
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0010001080000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0010001080000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0010001080000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Black Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100100000ULL, 0x0000000000000004ULL }},
+         {{ 0x0000000100100000ULL, 0x0000000000000004ULL }},
+      },
+      { // Bordeaux
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8100400000040000ULL, 0x0000000000000000ULL }},
+         {{ 0x0104000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000080ULL, 0x0000000000000000ULL }},
+         {{ 0x8104400000040080ULL, 0x0000000000000000ULL }},
+      },
+      { // Brussels
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1004000800080004ULL, 0x0000000000000000ULL }},
+         {{ 0x0004000000080000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1004000800080004ULL, 0x0000000000000000ULL }},
+      },
+      { // Bucharest
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0400000404100100ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004100000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4400000404100100ULL, 0x0000000000000000ULL }},
+      },
+      { // Budapest
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000400000000ULL, 0x0000000000000030ULL }},
+         {{ 0x4000000000000000ULL, 0x0000000000000010ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000400000000ULL, 0x0000000000000030ULL }},
+      },
+      { // Cadiz
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000012040000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000010ULL, 0x0000000000000000ULL }},
+         {{ 0x0000012040000010ULL, 0x0000000000000000ULL }},
+      },
+      { // Cagliari
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000001ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000001ULL }},
+      },
+      { // Castle Dracula
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000404000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000404000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Clermont-Ferrand
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8004440010000800ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8004440010000800ULL, 0x0000000000000000ULL }},
+      },
+      { // Cologne
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000001082001004ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000002001000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000001082001004ULL, 0x0000000000000000ULL }},
+      },
+      { // Constanta
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000004002000ULL, 0x0000000000000004ULL }},
+         {{ 0x0000000000002000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000400ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000004002400ULL, 0x0000000000000004ULL }},
+      },
+      { // Dublin
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000008000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000200000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000208000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Edinburgh
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000020000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000020000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001020000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // English Channel
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0009008800000010ULL, 0x0000000000000000ULL }},
+         {{ 0x0009008800000010ULL, 0x0000000000000000ULL }},
+      },
+      { // Florence
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020000020000000ULL, 0x0000000000000008ULL }},
+         {{ 0x0020100000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020100020000000ULL, 0x0000000000000008ULL }},
+      },
+      { // Frankfurt
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1002001000080000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000001000080000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1002001000080000ULL, 0x0000000000000000ULL }},
+      },
+      { // Galatz
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000400122000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000002000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000400122000ULL, 0x0000000000000000ULL }},
+      },
+      { // Galway
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000200000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000010ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000200010ULL, 0x0000000000000000ULL }},
+      },
+      { // Geneva
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1004040000040000ULL, 0x0000000000000040ULL }},
+         {{ 0x0000100000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1004140000040000ULL, 0x0000000000000040ULL }},
+      },
+      { // Genoa
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000140001000000ULL, 0x0000000000000008ULL }},
+         {{ 0x0000100000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000001ULL }},
+         {{ 0x0000140001000000ULL, 0x0000000000000009ULL }},
+      },
+      { // Granada
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000010000008002ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000010000008002ULL, 0x0000000000000000ULL }},
+      },
+      { // Hamburg
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000001000080200ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000200ULL, 0x0000000000000000ULL }},
+         {{ 0x0001000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001001000080200ULL, 0x0000000000000000ULL }},
+      },
+      { // Ionian Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0040000000000409ULL, 0x0000000000000003ULL }},
+         {{ 0x0040000000000409ULL, 0x0000000000000003ULL }},
+      },
+      { // Irish Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2000004000200010ULL, 0x0000000000000000ULL }},
+         {{ 0x2000004000200010ULL, 0x0000000000000000ULL }},
+      },
+      { // Klausenburg
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004026100ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004026100ULL, 0x0000000000000000ULL }},
+      },
+      { // Le Havre
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004400000001000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000800000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004400000801000ULL, 0x0000000000000000ULL }},
+      },
+      { // Leipzig
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002000082080200ULL, 0x0000000000000000ULL }},
+         {{ 0x0002000002000200ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002000082080200ULL, 0x0000000000000000ULL }},
+      },
+      { // Lisbon
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0080010000008000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000010000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000010ULL, 0x0000000000000000ULL }},
+         {{ 0x0080010000008010ULL, 0x0000000000000000ULL }},
+      },
+      { // Liverpool
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2000020000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000020000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000200000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2000020200000000ULL, 0x0000000000000000ULL }},
+      },
+      { // London
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2008020000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2000020000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000800000ULL, 0x0000000000000000ULL }},
+         {{ 0x2008020000800000ULL, 0x0000000000000000ULL }},
+      },
+      { // Madrid
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0180002040008002ULL, 0x0000000000000000ULL }},
+         {{ 0x0180002000000002ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0180002040008002ULL, 0x0000000000000000ULL }},
+      },
+      { // Manchester
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x000000c000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x000000c000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x000000c000400000ULL, 0x0000000000000000ULL }},
+      },
+      { // Marseilles
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8000100030040000ULL, 0x0000000000000040ULL }},
+         {{ 0x0004000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8004180030040000ULL, 0x0000000000000040ULL }},
+      },
+      { // Mediterranean Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000040000010032ULL, 0x0000000000000001ULL }},
+         {{ 0x0000040000010032ULL, 0x0000000000000001ULL }},
+      },
+      { // Milan
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000240020000000ULL, 0x0000000000000048ULL }},
+         {{ 0x0000000031000000ULL, 0x0000000000000040ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000240031000000ULL, 0x0000000000000048ULL }},
+      },
+      { // Munich
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1002100000000000ULL, 0x0000000000000078ULL }},
+         {{ 0x0002000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1002100000000000ULL, 0x0000000000000078ULL }},
+      },
+      { // Nantes
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004000800040800ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000080ULL, 0x0000000000000000ULL }},
+         {{ 0x0004000800040880ULL, 0x0000000000000000ULL }},
+      },
+      { // Naples
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020000000000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0020000000000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000001ULL }},
+         {{ 0x0020000000000040ULL, 0x0000000000000001ULL }},
+      },
+      { // North Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000080c00014ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000080c00014ULL, 0x0000000000000000ULL }},
+      },
+      { // Nuremburg
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1010201002000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000201000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1010201002000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Paris
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000400810041000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000040800001800ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000440810041800ULL, 0x0000000000000000ULL }},
+      },
+      { // Plymouth
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000008000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000800000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000008000800000ULL, 0x0000000000000000ULL }},
+      },
+      { // Prague
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002000000000200ULL, 0x0000000000000010ULL }},
+         {{ 0x0000000000000200ULL, 0x0000000000000010ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002000000000200ULL, 0x0000000000000010ULL }},
+      },
+      { // Rome
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000800001000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0000800001000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000001ULL }},
+         {{ 0x0000800001000040ULL, 0x0000000000000001ULL }},
+      },
+      { // Salonica
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0400000000000000ULL, 0x0000000000000002ULL }},
+         {{ 0x0400000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0400000100000000ULL, 0x0000000000000002ULL }},
+      },
+      { // Santander
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0100012000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000010000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000080ULL, 0x0000000000000000ULL }},
+         {{ 0x0100012000000080ULL, 0x0000000000000000ULL }},
+      },
+      { // Saragossa
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8080010000000822ULL, 0x0000000000000000ULL }},
+         {{ 0x0000010000000820ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8080010000000822ULL, 0x0000000000000000ULL }},
+      },
+      { // Sarajevo
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0c00000000000100ULL, 0x0000000000000022ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0c00000000000100ULL, 0x0000000000000022ULL }},
+      },
+      { // Sofia
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0240000000002100ULL, 0x0000000000000006ULL }},
+         {{ 0x0040000000000100ULL, 0x0000000000000004ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0240000000002100ULL, 0x0000000000000006ULL }},
+      },
+      { // St Joseph and St Marys
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4200000000000100ULL, 0x0000000000000020ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4200000000000100ULL, 0x0000000000000020ULL }},
+      },
+      { // Strasbourg
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0006200012081000ULL, 0x0000000000000040ULL }},
+         {{ 0x0000000002000000ULL, 0x0000000000000040ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0006200012081000ULL, 0x0000000000000040ULL }},
+      },
+      { // Swansea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x000000c000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000008000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000200000000ULL, 0x0000000000000000ULL }},
+         {{ 0x000000c200000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Szeged
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0800000400004100ULL, 0x0000000000000020ULL }},
+         {{ 0x0000000000006100ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0800000400006100ULL, 0x0000000000000020ULL }},
+      },
+      { // Toulouse
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0100040000040820ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0100040000040820ULL, 0x0000000000000000ULL }},
+      },
+      { // Tyrrhenian Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020880120010000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020880120010000ULL, 0x0000000000000000ULL }},
+      },
+      { // Valona
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0640000000000008ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0640000100000008ULL, 0x0000000000000000ULL }},
+      },
+      { // Varna
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0400000000100000ULL, 0x0000000000000000ULL }},
+         {{ 0x0400000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000400ULL, 0x0000000000000000ULL }},
+         {{ 0x0400000000100400ULL, 0x0000000000000000ULL }},
+      },
+      { // Venice
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000300021000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000010ULL }},
+         {{ 0x0000000000000001ULL, 0x0000000000000000ULL }},
+         {{ 0x0000300021000001ULL, 0x0000000000000010ULL }},
+      },
+      { // Vienna
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0010200000004000ULL, 0x0000000000000020ULL }},
+         {{ 0x0010000000004000ULL, 0x0000000000000008ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0010200000004000ULL, 0x0000000000000028ULL }},
+      },
+      { // Zagreb
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4a00200000004000ULL, 0x0000000000000010ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4a00200000004000ULL, 0x0000000000000010ULL }},
+      },
+      { // Zurich
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000340010000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000100000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000340010000000ULL, 0x0000000000000000ULL }},
+      },
+   },
+   { // rail
+      { // Adriatic Sea
+         {{ 0x0000000000000001ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000001ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000001ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000001ULL, 0x0000000000000000ULL }},
+      },
+      { // Alicante
+         {{ 0x0000000000000002ULL, 0x0000000000000000ULL }},
+         {{ 0x0000010000000022ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000022ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000822ULL, 0x0000000000000000ULL }},
+      },
+      { // Amsterdam
+         {{ 0x0000000000000004ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000004ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000004ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000004ULL, 0x0000000000000000ULL }},
+      },
+      { // Athens
+         {{ 0x0000000000000008ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000008ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000008ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000008ULL, 0x0000000000000000ULL }},
+      },
+      { // Atlantic Ocean
+         {{ 0x0000000000000010ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000010ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000010ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000010ULL, 0x0000000000000000ULL }},
+      },
+      { // Barcelona
+         {{ 0x0000000000000020ULL, 0x0000000000000000ULL }},
+         {{ 0x0100000000000022ULL, 0x0000000000000000ULL }},
+         {{ 0x0100010000000822ULL, 0x0000000000000000ULL }},
+         {{ 0x0184012000000822ULL, 0x0000000000000000ULL }},
+      },
+      { // Bari
+         {{ 0x0000000000000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0000800000000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0020800000000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0020800001000040ULL, 0x0000000000000000ULL }},
+      },
+      { // Bay of Biscay
+         {{ 0x0000000000000080ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000080ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000080ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000080ULL, 0x0000000000000000ULL }},
+      },
+      { // Belgrade
+         {{ 0x0000000000000100ULL, 0x0000000000000000ULL }},
+         {{ 0x4400000000000100ULL, 0x0000000000000000ULL }},
+         {{ 0x4440000000006100ULL, 0x0000000000000004ULL }},
+         {{ 0x4440000004106100ULL, 0x0000000000000014ULL }},
+      },
+      { // Berlin
+         {{ 0x0000000000000200ULL, 0x0000000000000000ULL }},
+         {{ 0x0010001080000200ULL, 0x0000000000000000ULL }},
+         {{ 0x0012001082000200ULL, 0x0000000000000010ULL }},
+         {{ 0x1012201082084200ULL, 0x0000000000000018ULL }},
+      },
+      { // Black Sea
+         {{ 0x0000000000000400ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000400ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000400ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000000400ULL, 0x0000000000000000ULL }},
+      },
+      { // Bordeaux
+         {{ 0x0000000000000800ULL, 0x0000000000000000ULL }},
+         {{ 0x0104000000000800ULL, 0x0000000000000000ULL }},
+         {{ 0x0104050800001820ULL, 0x0000000000000000ULL }},
+         {{ 0x0184052800081822ULL, 0x0000000000000000ULL }},
+      },
+      { // Brussels
+         {{ 0x0000000000001000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004000000081000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004040802081800ULL, 0x0000000000000000ULL }},
+         {{ 0x1104041802081800ULL, 0x0000000000000000ULL }},
+      },
+      { // Bucharest
+         {{ 0x0000000000002000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004102000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004106100ULL, 0x0000000000000000ULL }},
+         {{ 0x4400000004106100ULL, 0x0000000000000010ULL }},
+      },
+      { // Budapest
+         {{ 0x0000000000004000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000000004000ULL, 0x0000000000000010ULL }},
+         {{ 0x4010000000006100ULL, 0x0000000000000018ULL }},
+         {{ 0x4410000004106300ULL, 0x0000000000000018ULL }},
+      },
+      { // Cadiz
+         {{ 0x0000000000008000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000008000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000008000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000008000ULL, 0x0000000000000000ULL }},
+      },
+      { // Cagliari
+         {{ 0x0000000000010000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000010000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000010000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000010000ULL, 0x0000000000000000ULL }},
+      },
+      { // Castle Dracula
+         {{ 0x0000000000020000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000020000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000020000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000020000ULL, 0x0000000000000000ULL }},
+      },
+      { // Clermont-Ferrand
+         {{ 0x0000000000040000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000040000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000040000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000040000ULL, 0x0000000000000000ULL }},
+      },
+      { // Cologne
+         {{ 0x0000000000080000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000002081000ULL, 0x0000000000000000ULL }},
+         {{ 0x1004001002081000ULL, 0x0000000000000000ULL }},
+         {{ 0x1006041802081a00ULL, 0x0000000000000040ULL }},
+      },
+      { // Constanta
+         {{ 0x0000000000100000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000102000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004102000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004106100ULL, 0x0000000000000000ULL }},
+      },
+      { // Dublin
+         {{ 0x0000000000200000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000200000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000200000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000200000ULL, 0x0000000000000000ULL }},
+      },
+      { // Edinburgh
+         {{ 0x0000000000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000020000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x000002c000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x200002c000400000ULL, 0x0000000000000000ULL }},
+      },
+      { // English Channel
+         {{ 0x0000000000800000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000800000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000800000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000000800000ULL, 0x0000000000000000ULL }},
+      },
+      { // Florence
+         {{ 0x0000000001000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020100001000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020900031000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1020900031000040ULL, 0x0000000000000040ULL }},
+      },
+      { // Frankfurt
+         {{ 0x0000000002000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000001002080000ULL, 0x0000000000000000ULL }},
+         {{ 0x1002001002081200ULL, 0x0000000000000040ULL }},
+         {{ 0x1016301082081200ULL, 0x0000000000000040ULL }},
+      },
+      { // Galatz
+         {{ 0x0000000004000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000004002000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004102000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000004106100ULL, 0x0000000000000000ULL }},
+      },
+      { // Galway
+         {{ 0x0000000008000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000008000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000008000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000008000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Geneva
+         {{ 0x0000000010000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000100010000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000100031000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1020100031000000ULL, 0x0000000000000040ULL }},
+      },
+      { // Genoa
+         {{ 0x0000000020000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000100020000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000100031000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1020100031000000ULL, 0x0000000000000040ULL }},
+      },
+      { // Granada
+         {{ 0x0000000040000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000040000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000040000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000040000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Hamburg
+         {{ 0x0000000080000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000080000200ULL, 0x0000000000000000ULL }},
+         {{ 0x0010001080000200ULL, 0x0000000000000000ULL }},
+         {{ 0x0012001082000200ULL, 0x0000000000000010ULL }},
+      },
+      { // Ionian Sea
+         {{ 0x0000000100000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000100000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Irish Sea
+         {{ 0x0000000200000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000200000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000200000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000200000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Klausenburg
+         {{ 0x0000000400000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000400000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000400000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000000400000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Le Havre
+         {{ 0x0000000800000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004000800000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004040800001800ULL, 0x0000000000000000ULL }},
+         {{ 0x0104040800081800ULL, 0x0000000000000000ULL }},
+      },
+      { // Leipzig
+         {{ 0x0000001000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002001002000200ULL, 0x0000000000000000ULL }},
+         {{ 0x1012201082080200ULL, 0x0000000000000000ULL }},
+         {{ 0x1012201082081200ULL, 0x0000000000000050ULL }},
+      },
+      { // Lisbon
+         {{ 0x0000002000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000012000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000002ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000822ULL, 0x0000000000000000ULL }},
+      },
+      { // Liverpool
+         {{ 0x0000004000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000024000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x000002c000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x200002c000400000ULL, 0x0000000000000000ULL }},
+      },
+      { // London
+         {{ 0x0000008000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2000028000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x200002c000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x200002c000400000ULL, 0x0000000000000000ULL }},
+      },
+      { // Madrid
+         {{ 0x0000010000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000002ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000822ULL, 0x0000000000000000ULL }},
+         {{ 0x0184012000000822ULL, 0x0000000000000000ULL }},
+      },
+      { // Manchester
+         {{ 0x0000020000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x000002c000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x200002c000400000ULL, 0x0000000000000000ULL }},
+         {{ 0x200002c000400000ULL, 0x0000000000000000ULL }},
+      },
+      { // Marseilles
+         {{ 0x0000040000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004040000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004040800001800ULL, 0x0000000000000000ULL }},
+         {{ 0x0104040800081800ULL, 0x0000000000000000ULL }},
+      },
+      { // Mediterranean Sea
+         {{ 0x0000080000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000080000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Milan
+         {{ 0x0000100000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000100031000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1020100031000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1020900033000000ULL, 0x0000000000000040ULL }},
+      },
+      { // Munich
+         {{ 0x0000200000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002200000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002201000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002201002000200ULL, 0x0000000000000000ULL }},
+      },
+      { // Nantes
+         {{ 0x0000400000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000400000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000400000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0000400000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Naples
+         {{ 0x0000800000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020800000000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0020800001000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0020900001000040ULL, 0x0000000000000000ULL }},
+      },
+      { // North Sea
+         {{ 0x0001000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0001000000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Nuremburg
+         {{ 0x0002000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002201000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0002201002000200ULL, 0x0000000000000000ULL }},
+         {{ 0x1012201082080200ULL, 0x0000000000000000ULL }},
+      },
+      { // Paris
+         {{ 0x0004000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0004040800001800ULL, 0x0000000000000000ULL }},
+         {{ 0x0104040800081800ULL, 0x0000000000000000ULL }},
+         {{ 0x0104050802081820ULL, 0x0000000000000000ULL }},
+      },
+      { // Plymouth
+         {{ 0x0008000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0008000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0008000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0008000000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Prague
+         {{ 0x0010000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0010000000000200ULL, 0x0000000000000010ULL }},
+         {{ 0x0010001080004200ULL, 0x0000000000000018ULL }},
+         {{ 0x4012001082004200ULL, 0x0000000000000018ULL }},
+      },
+      { // Rome
+         {{ 0x0020000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020800001000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0020900001000040ULL, 0x0000000000000000ULL }},
+         {{ 0x0020900031000040ULL, 0x0000000000000040ULL }},
+      },
+      { // Salonica
+         {{ 0x0040000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0440000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0440000000000100ULL, 0x0000000000000004ULL }},
+         {{ 0x4440000000000100ULL, 0x0000000000000004ULL }},
+      },
+      { // Santander
+         {{ 0x0080000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0080010000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000002ULL, 0x0000000000000000ULL }},
+         {{ 0x0180012000000822ULL, 0x0000000000000000ULL }},
+      },
+      { // Saragossa
+         {{ 0x0100000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0100010000000820ULL, 0x0000000000000000ULL }},
+         {{ 0x0184012000000822ULL, 0x0000000000000000ULL }},
+         {{ 0x0184052800001822ULL, 0x0000000000000000ULL }},
+      },
+      { // Sarajevo
+         {{ 0x0200000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0200000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0200000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0200000000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Sofia
+         {{ 0x0400000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0440000000000100ULL, 0x0000000000000004ULL }},
+         {{ 0x4440000000000100ULL, 0x0000000000000004ULL }},
+         {{ 0x4440000000006100ULL, 0x0000000000000004ULL }},
+      },
+      { // St Joseph and St Marys
+         {{ 0x0800000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0800000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0800000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x0800000000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Strasbourg
+         {{ 0x1000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x1000000002000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1000101002080000ULL, 0x0000000000000040ULL }},
+         {{ 0x1002101033081200ULL, 0x0000000000000040ULL }},
+      },
+      { // Swansea
+         {{ 0x2000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2000008000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x2000028000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x200002c000400000ULL, 0x0000000000000000ULL }},
+      },
+      { // Szeged
+         {{ 0x4000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x4000000000006100ULL, 0x0000000000000000ULL }},
+         {{ 0x4400000004106100ULL, 0x0000000000000010ULL }},
+         {{ 0x4450000004106100ULL, 0x000000000000001cULL }},
+      },
+      { // Toulouse
+         {{ 0x8000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8000000000000000ULL, 0x0000000000000000ULL }},
+         {{ 0x8000000000000000ULL, 0x0000000000000000ULL }},
+      },
+      { // Tyrrhenian Sea
+         {{ 0x0000000000000000ULL, 0x0000000000000001ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000001ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000001ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000001ULL }},
+      },
+      { // Valona
+         {{ 0x0000000000000000ULL, 0x0000000000000002ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000002ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000002ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000002ULL }},
+      },
+      { // Varna
+         {{ 0x0000000000000000ULL, 0x0000000000000004ULL }},
+         {{ 0x0400000000000000ULL, 0x0000000000000004ULL }},
+         {{ 0x0440000000000100ULL, 0x0000000000000004ULL }},
+         {{ 0x4440000000000100ULL, 0x0000000000000004ULL }},
+      },
+      { // Venice
+         {{ 0x0000000000000000ULL, 0x0000000000000008ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000018ULL }},
+         {{ 0x0010000000004000ULL, 0x0000000000000018ULL }},
+         {{ 0x4010000000004200ULL, 0x0000000000000018ULL }},
+      },
+      { // Vienna
+         {{ 0x0000000000000000ULL, 0x0000000000000010ULL }},
+         {{ 0x0010000000004000ULL, 0x0000000000000018ULL }},
+         {{ 0x4010000000004200ULL, 0x0000000000000018ULL }},
+         {{ 0x4010001080006300ULL, 0x0000000000000018ULL }},
+      },
+      { // Zagreb
+         {{ 0x0000000000000000ULL, 0x0000000000000020ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000020ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000020ULL }},
+         {{ 0x0000000000000000ULL, 0x0000000000000020ULL }},
+      },
+      { // Zurich
+         {{ 0x0000000000000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1000100000000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1000100033000000ULL, 0x0000000000000040ULL }},
+         {{ 0x1020101033080000ULL, 0x0000000000000040ULL }},
+      },
+   },
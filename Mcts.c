@@ -0,0 +1,653 @@
+// Mcts.c ... Monte Carlo tree search for the hunters
+//
+// With a ThreadPool every thread runs simulations on the one tree.
+// Nodes are claimed from the pool with an atomic add and linked in with
+// a compare-and-swap, and their counts are updated with atomic adds. A
+// simulation counts its visit on the way down, before its result is in,
+// so until then the path looks like a loss (a "virtual loss") and other
+// threads are steered to other moves.
+//
+// Only the thread that called the search ever registers moves.
+//
+// Dracula's moves go into the tree as the hunters see them (C?, S?, HI,
+// D1...): a node for C? stands for every city he could have gone to,
+// and a simulation following it picks one at random. So the tree's
+// moves are the moves in pastPlays, and the next search can pick up
+// the subtree for the plays made since the last one, after moving it
+// to the front of a spare array so the rest of the nodes are free.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <assert.h>
+#include "Globals.h"
+#include "Game.h"
+#include "Places.h"
+#include "Map.h"
+#include "GameState.h"
+#include "HunterView.h"
+#include "ThreadPool.h"
+#include "Belief.h"
+#include "ParticleFilter.h"
+#include "TimeBudget.h"
+#include "Rollout.h"
+#include "Random.h"
+#include "Mcts.h"
+
+#define NO_NODE          -1
+#define MAX_PATH         256    // deepest the tree can be followed
+#define ROLLOUT_MOVES    50     // ten rounds
+#define EXPLORATION      0.7    // weight of UCB's exploration term
+#define CHECK_EVERY      64     // simulations between looks at the clock
+#define REPORT_NSECS     2000000L  // how often the best move is checked
+#define MAX_GUESSES      32     // tries at a trail that fits before settling
+#define WIN_SCALE        1024   // wins are kept as fixed point
+
+typedef struct node {
+    int      firstChild;
+    int      nextSibling;
+    int      visits;
+    int      available;  // simulations in which the move could be made
+    int64_t  wins;       // for the player who made the move, times WIN_SCALE
+    int16_t  move;
+    int8_t   player;     // who made the move
+} Node;
+
+// what each thread needs of its own to run simulations
+typedef struct searcher {
+    Mcts            mcts;
+    const GameState *root;
+    uint64_t        random;       // xorshift64* state, never 0
+    long            simulations;
+    TimeBudget      budget;       // its own copy, timing its batches
+} Searcher;
+
+struct mcts {
+    Node       *nodes;
+    Node       *spare;        // for moving the part of the tree kept
+    int         maxNodes;
+    int         numNodes;     // can go past maxNodes once they run out
+    int         root;         // NO_NODE if there's no tree yet
+    GameState   rootState;    // the position at the root, as the hunters know it
+    int         pondering;    // TRUE while searching in the background
+    TimeBudget  budget;       // of the current search
+    ThreadPool  pool;         // NULL to search on the calling thread
+    int         numSearchers;
+    Searcher   *searchers;
+    ParticleFilter particles; // trails to guess from, when searching from a view
+    int         useParticles;
+};
+
+static LocationID search(Mcts mcts, const GameState *state, int msecs,
+                         int useParticles);
+static void searchTask(void *arg);
+static void ponderTask(void *arg);
+static int keepSubtree(Mcts mcts, const GameState *state);
+static void moveToFront(Mcts mcts, int keep);
+static LocationID concreteMove(Searcher *searcher, LocationID move,
+                               LocationID moves[], int numMoves);
+static void simulate(Searcher *searcher);
+static int guessTrail(Searcher *searcher, GameState *state, int strict);
+static double rollout(Searcher *searcher, GameState *state);
+static double hunterValue(const GameState *state);
+static int newNode(Mcts mcts, int parent, int knownHead, LocationID move, PlayerID player);
+static int bestChild(Mcts mcts);
+static LocationID reportBest(Mcts mcts, LocationID best);
+static void registerMove(LocationID move);
+
+Mcts newMcts(int maxNodes, unsigned int seed)
+{
+    assert(maxNodes > 0);
+    Mcts mcts = malloc(sizeof(struct mcts));
+    assert(mcts != NULL);
+    mcts->nodes = malloc(maxNodes*sizeof(Node));
+    mcts->spare = malloc(maxNodes*sizeof(Node));
+    assert(mcts->nodes != NULL && mcts->spare != NULL);
+    mcts->maxNodes = maxNodes;
+    mcts->numNodes = 0;
+    mcts->root = NO_NODE;
+    mcts->pondering = FALSE;
+    mcts->pool = NULL;
+    mcts->numSearchers = 0;
+    mcts->searchers = NULL;
+    mctsSetPool(mcts, NULL);
+    mcts->searchers[0].random = (uint64_t)seed*0x9E3779B97F4A7C15ULL + 1;
+    mcts->particles = newParticleFilter(DEFAULT_PARTICLES, seed);
+    mcts->useParticles = FALSE;
+    return mcts;
+}
+
+void disposeMcts(Mcts toBeDeleted)
+{
+    mctsStopPondering(toBeDeleted);
+    free(toBeDeleted->searchers);
+    disposeParticleFilter(toBeDeleted->particles);
+    free(toBeDeleted->spare);
+    free(toBeDeleted->nodes);
+    free(toBeDeleted);
+}
+
+// searches with every thread of pool (NULL for just the calling thread)
+void mctsSetPool(Mcts mcts, ThreadPool pool)
+{
+    mctsStopPondering(mcts);
+    int numSearchers = pool == NULL ? 1 : poolThreads(pool);
+    uint64_t seed = mcts->searchers == NULL ? 1 : mcts->searchers[0].random;
+    free(mcts->searchers);
+    mcts->searchers = malloc(numSearchers*sizeof(Searcher));
+    assert(mcts->searchers != NULL);
+    int i;
+    for (i = 0; i < numSearchers; i++){
+        mcts->searchers[i].mcts = mcts;
+        mcts->searchers[i].random = seed + (uint64_t)i*0x9E3779B97F4A7C15ULL;
+        mcts->searchers[i].simulations = 0;
+    }
+    mcts->numSearchers = numSearchers;
+    mcts->pool = pool;
+}
+
+// searches for the current hunter's best move
+LocationID mctsHunterMove(Mcts mcts, HunterView view, int msecs)
+{
+    GameState state;
+    giveMeTheState(view, &state);
+    mctsStopPondering(mcts);
+    copyParticles(mcts->particles, giveMeTheParticles(view));
+    return search(mcts, &state, msecs, TRUE);
+}
+
+// searches from a state the hunters could be in
+LocationID mctsSearch(Mcts mcts, const GameState *state, int msecs)
+{
+    return search(mcts, state, msecs, FALSE);
+}
+
+// searches from state, guessing Dracula's trail from the particles or not
+static LocationID search(Mcts mcts, const GameState *state, int msecs,
+                         int useParticles)
+{
+    budgetStart(&mcts->budget, msecs);
+    assert(state->curr != PLAYER_DRACULA);
+    mctsStopPondering(mcts);
+    mcts->useParticles = useParticles;
+
+    //have a move in before anything else: resting is always allowed
+    //once the hunter is on the board
+    LocationID moves[MAX_MOVES];
+    legalMoves(state, moves);
+    LocationID best = state->location[state->curr];
+    if (!validPlace(best)){
+        best = moves[0];
+    }
+    registerMove(best);
+
+    //carry on with what was searched of this position, if anything
+    if (!keepSubtree(mcts, state)){
+        mcts->numNodes = 0;
+        mcts->root = newNode(mcts, NO_NODE, NO_NODE, NOWHERE, PLAYER_DRACULA);
+    }
+    mcts->rootState = *state;
+    int i;
+    for (i = 0; i < mcts->numSearchers; i++){
+        mcts->searchers[i].root = &mcts->rootState;
+        mcts->searchers[i].simulations = 0;
+        mcts->searchers[i].budget = mcts->budget;
+    }
+
+    if (mcts->pool == NULL){
+        //batches of simulations while there's time for another
+        TimeBudget *budget = &mcts->searchers[0].budget;
+        while (budgetAllowsNext(budget)){
+            budgetIterationStarted(budget);
+            for (i = 0; i < CHECK_EVERY; i++){
+                simulate(&mcts->searchers[0]);
+            }
+            mcts->searchers[0].simulations += CHECK_EVERY;
+            budgetIterationDone(budget);
+            best = reportBest(mcts, best);
+        }
+        return best;
+    }
+
+    //the threads search while this one keeps the registered move current
+    for (i = 0; i < mcts->numSearchers; i++){
+        poolSubmit(mcts->pool, searchTask, &mcts->searchers[i]);
+    }
+    long left;
+    while ((left = budgetRemaining(&mcts->budget)) > 0){
+        struct timespec pause = {0, left < REPORT_NSECS ? left : REPORT_NSECS};
+        nanosleep(&pause, NULL);
+        if (!budgetExpired(&mcts->budget)){
+            best = reportBest(mcts, best);
+        }
+    }
+    poolWait(mcts->pool);
+    return best;
+}
+
+// searches in the background from after move, until the next search
+void mctsPonder(Mcts mcts, LocationID move)
+{
+    mctsStopPondering(mcts);
+    if (mcts->pool == NULL || mcts->root == NO_NODE){
+        return;
+    }
+    int child = mcts->nodes[mcts->root].firstChild;
+    while (child != NO_NODE && mcts->nodes[child].move != move){
+        child = mcts->nodes[child].nextSibling;
+    }
+    if (child == NO_NODE){
+        return;
+    }
+    Undo undo;
+    applyMove(&mcts->rootState, move, &undo);
+    if (isGameOver(&mcts->rootState)){
+        mcts->root = NO_NODE;
+        return;
+    }
+    mcts->root = child;
+    mcts->pondering = TRUE;
+    int i;
+    for (i = 0; i < mcts->numSearchers; i++){
+        poolSubmit(mcts->pool, ponderTask, &mcts->searchers[i]);
+    }
+}
+
+// stops searching in the background, if it is
+void mctsStopPondering(Mcts mcts)
+{
+    if (mcts->pondering){
+        __atomic_store_n(&mcts->pondering, FALSE, __ATOMIC_RELAXED);
+        poolWait(mcts->pool);
+    }
+}
+
+long mctsSimulations(Mcts mcts)
+{
+    long simulations = 0;
+    int i;
+    for (i = 0; i < mcts->numSearchers; i++){
+        simulations += mcts->searchers[i].simulations;
+    }
+    return simulations;
+}
+
+int mctsNodes(Mcts mcts)
+{
+    return mcts->numNodes < mcts->maxNodes ? mcts->numNodes : mcts->maxNodes;
+}
+
+// simulations in the background until told to stop
+static void ponderTask(void *arg)
+{
+    Searcher *searcher = arg;
+    int i;
+    for (i = 0; i < CHECK_EVERY; i++){
+        simulate(searcher);
+    }
+    if (__atomic_load_n(&searcher->mcts->pondering, __ATOMIC_RELAXED)){
+        poolSubmit(searcher->mcts->pool, ponderTask, searcher);
+    }
+}
+
+// makes the node for state the root if the tree has one, following the
+// plays made since the root's position; FALSE if it hasn't
+static int keepSubtree(Mcts mcts, const GameState *state)
+{
+    if (mcts->root == NO_NODE){
+        return FALSE;
+    }
+    const GameState *was = &mcts->rootState;
+    int turnWas = was->round*NUM_PLAYERS + was->curr;
+    int turn = state->round*NUM_PLAYERS + state->curr;
+    if (turn < turnWas || turn - turnWas >= NUM_PLAYERS){
+        return FALSE;
+    }
+
+    int node = mcts->root;
+    int t;
+    for (t = turnWas; t < turn && node != NO_NODE; t++){
+        PlayerID player = t % NUM_PLAYERS;
+        LocationID move;
+        if (player == PLAYER_DRACULA){
+            move = hiddenMove(trailMove(state, 0));
+        } else {
+            move = state->location[player];
+        }
+        int child = mcts->nodes[node].firstChild;
+        while (child != NO_NODE && mcts->nodes[child].move != move){
+            child = mcts->nodes[child].nextSibling;
+        }
+        node = child;
+    }
+    //and the hunters who haven't moved since are where they were
+    int h;
+    for (h = 0; h < NUM_HUNTERS && node != NO_NODE; h++){
+        int moved = (h - was->curr + NUM_PLAYERS) % NUM_PLAYERS < turn - turnWas;
+        if (!moved && state->location[h] != was->location[h]){
+            node = NO_NODE;
+        }
+    }
+    if (node == NO_NODE){
+        return FALSE;
+    }
+    moveToFront(mcts, node);
+    return TRUE;
+}
+
+// copies the subtree under keep to the front of the spare nodes, breadth
+// first, and makes them the tree
+static void moveToFront(Mcts mcts, int keep)
+{
+    Node *to = mcts->spare;
+    to[0] = mcts->nodes[keep];
+    to[0].nextSibling = NO_NODE;
+    int done, numNodes = 1;
+    for (done = 0; done < numNodes; done++){
+        //its children are still in the old array
+        int child = to[done].firstChild;
+        int last = NO_NODE;
+        to[done].firstChild = NO_NODE;
+        for (; child != NO_NODE; child = mcts->nodes[child].nextSibling){
+            to[numNodes] = mcts->nodes[child];
+            to[numNodes].nextSibling = NO_NODE;
+            if (last == NO_NODE){
+                to[done].firstChild = numNodes;
+            } else {
+                to[last].nextSibling = numNodes;
+            }
+            last = numNodes++;
+        }
+    }
+    mcts->spare = mcts->nodes;
+    mcts->nodes = to;
+    mcts->numNodes = numNodes;
+    mcts->root = 0;
+}
+
+// one of the legal moves the hunters would see as move, at random (only
+// Dracula's moves are hidden from them)
+static LocationID concreteMove(Searcher *searcher, LocationID move,
+                               LocationID moves[], int numMoves)
+{
+    if (move != CITY_UNKNOWN && move != SEA_UNKNOWN){
+        return move;
+    }
+    int i, count = 0;
+    for (i = 0; i < numMoves; i++){
+        count += hiddenMove(moves[i]) == move;
+    }
+    int pick = randomBelow(&searcher->random, count);
+    for (i = 0; hiddenMove(moves[i]) != move || pick-- > 0; i++){
+        ;
+    }
+    return moves[i];
+}
+
+// a batch of simulations on a pool thread, then back in the queue for
+// another batch if there's time for one
+static void searchTask(void *arg)
+{
+    Searcher *searcher = arg;
+    budgetIterationStarted(&searcher->budget);
+    int i;
+    for (i = 0; i < CHECK_EVERY; i++){
+        simulate(searcher);
+    }
+    searcher->simulations += CHECK_EVERY;
+    budgetIterationDone(&searcher->budget);
+    if (budgetAllowsNext(&searcher->budget)){
+        poolSubmit(searcher->mcts->pool, searchTask, searcher);
+    }
+}
+
+// one simulation: guess Dracula's trail, follow the tree down (growing
+// it by a node), play out the rest at random and score the path
+static void simulate(Searcher *searcher)
+{
+    Mcts mcts = searcher->mcts;
+    GameState state = *searcher->root;
+    if (!mcts->useParticles ||
+        !particleGuess(mcts->particles, &state, &searcher->random)){
+        int tries = 0;
+        while (!guessTrail(searcher, &state, tries < MAX_GUESSES)){
+            state = *searcher->root;
+            tries ++;
+        }
+    }
+
+    int path[MAX_PATH];
+    int depth = 0;
+    int node = mcts->root;
+    path[depth++] = node;
+    __atomic_add_fetch(&mcts->nodes[node].visits, 1, __ATOMIC_RELAXED);
+    while (!isGameOver(&state) && depth < MAX_PATH){
+        LocationID moves[MAX_MOVES];
+        int numMoves = legalMoves(&state, moves);
+        if (numMoves == 0){
+            break;
+        }
+        //move codes all fit in 128 bits, so a LocationSet holds them
+        LocationSet legal = setEmpty();
+        int i;
+        for (i = 0; i < numMoves; i++){
+            setAdd(&legal, state.curr == PLAYER_DRACULA ? hiddenMove(moves[i])
+                                                        : moves[i]);
+        }
+
+        //the best child that's legal this time, and which moves have one
+        LocationSet tried = setEmpty();
+        int best = NO_NODE;
+        double bestScore = -1;
+        int head = __atomic_load_n(&mcts->nodes[node].firstChild, __ATOMIC_ACQUIRE);
+        int child;
+        for (child = head; child != NO_NODE; child = mcts->nodes[child].nextSibling){
+            Node *c = &mcts->nodes[child];
+            if (!setHas(legal, c->move)){
+                continue;
+            }
+            setAdd(&tried, c->move);
+            int available = __atomic_add_fetch(&c->available, 1, __ATOMIC_RELAXED);
+            int visits = __atomic_load_n(&c->visits, __ATOMIC_RELAXED);
+            double wins = (double)__atomic_load_n(&c->wins, __ATOMIC_RELAXED) / WIN_SCALE;
+            double score = wins/visits + EXPLORATION*sqrt(log(available)/visits);
+            if (score > bestScore){
+                bestScore = score;
+                best = child;
+            }
+        }
+
+        Undo undo;
+        LocationSet untried = setMinus(legal, tried);
+        if (!setIsEmpty(untried) &&
+            __atomic_load_n(&mcts->numNodes, __ATOMIC_RELAXED) < mcts->maxNodes){
+            //grow the tree by one of the moves not tried yet
+            LocationID options[MAX_MOVES];
+            int numOptions = setToArray(untried, options);
+            LocationID move = options[randomBelow(&searcher->random, numOptions)];
+            int added = newNode(mcts, node, head, move, state.curr);
+            if (added != NO_NODE){
+                path[depth++] = added;
+                move = concreteMove(searcher, move, moves, numMoves);
+                applyMove(&state, move, &undo);
+                break;
+            }
+        }
+        if (best == NO_NODE){
+            break;
+        }
+        __atomic_add_fetch(&mcts->nodes[best].visits, 1, __ATOMIC_RELAXED);
+        LocationID move = concreteMove(searcher, mcts->nodes[best].move,
+                                       moves, numMoves);
+        applyMove(&state, move, &undo);
+        node = best;
+        path[depth++] = node;
+    }
+
+    //the visits were counted on the way down
+    double value = rollout(searcher, &state);
+    int64_t hunterWins = (int64_t)(value*WIN_SCALE);
+    int i;
+    for (i = 1; i < depth; i++){
+        Node *n = &mcts->nodes[path[i]];
+        int64_t wins = n->player == PLAYER_DRACULA ? WIN_SCALE - hunterWins : hunterWins;
+        __atomic_add_fetch(&n->wins, wins, __ATOMIC_RELAXED);
+    }
+}
+
+// fills in Dracula's unrevealed moves with places he could have gone,
+// oldest first; returns FALSE if the guess ran into something he couldn't
+// have done (only when strict: otherwise anything goes where nothing fits)
+static int guessTrail(Searcher *searcher, GameState *state, int strict)
+{
+    Map map = newMap();
+    LocationID where[TRAIL_SIZE];
+    LocationID prev = UNKNOWN_LOCATION;
+    uint64_t movesWord = 0, whereWord = 0;
+    int i, j;
+    for (i = TRAIL_SIZE-1; i >= 0; i--){
+        LocationID move = trailMove(state, i);
+        LocationID w = trailWhere(state, i);
+        if (move == HIDE && validPlace(prev)){
+            w = prev;
+        } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5 &&
+                   i + move - DOUBLE_BACK_1 + 1 < TRAIL_SIZE){
+            w = where[i + move - DOUBLE_BACK_1 + 1];
+        }
+
+        LocationSet reachable = setAll();
+        if (validPlace(prev)){
+            reachable = setUnion(connectionSet(map, prev, ROAD),
+                                 connectionSet(map, prev, BOAT));
+        }
+        if (w == CITY_UNKNOWN || w == SEA_UNKNOWN){
+            //somewhere he could get to, and for a plain move somewhere
+            //that's not already in his trail (a hide or double back whose
+            //start has left the trail can be anywhere he could get to)
+            LocationSet options = setIntersect(reachable,
+                                  w == CITY_UNKNOWN ? draculaCities()
+                                                    : draculaSeas());
+            if (move == CITY_UNKNOWN || move == SEA_UNKNOWN){
+                for (j = i+1; j < TRAIL_SIZE; j++){
+                    if (validPlace(where[j])) setRemove(&options, where[j]);
+                }
+            }
+            if (setIsEmpty(options)){
+                if (strict) return FALSE;
+                options = w == CITY_UNKNOWN ? draculaCities() : draculaSeas();
+            }
+            w = setNth(options, randomBelow(&searcher->random, setSize(options)));
+            if (move == CITY_UNKNOWN || move == SEA_UNKNOWN){
+                move = w;
+            }
+        } else if (strict && validPlace(w) && validPlace(move) && !setHas(reachable, w)){
+            return FALSE;
+        }
+        where[i] = w;
+        prev = w;
+        movesWord = (movesWord << 8) | (uint8_t)move;
+        whereWord = (whereWord << 8) | (uint8_t)w;
+    }
+    state->trailMoves = movesWord;
+    state->trailWhere = whereWord;
+    state->hash = hashGameState(state);
+    return TRUE;
+}
+
+// plays random moves from the state, returns how it went for the hunters
+static double rollout(Searcher *searcher, GameState *state)
+{
+    playout(state, &searcher->random, ROLLOUT_MOVES, FALSE);
+    return hunterValue(state);
+}
+
+// 1 if the hunters have won, 0 if Dracula has, otherwise in between
+// depending on how much blood he has lost against the score lost
+static double hunterValue(const GameState *state)
+{
+    if (state->draculaHealth <= 0){
+        return 1;
+    }
+    if (state->score <= 0){
+        return 0;
+    }
+    double bloodLost = (double)(GAME_START_BLOOD_POINTS - state->draculaHealth)
+                       / GAME_START_BLOOD_POINTS;
+    double scoreLost = (double)(GAME_START_SCORE - state->score) / GAME_START_SCORE;
+    double value = 0.5 + 0.4*bloodLost - 0.4*scoreLost;
+    return value < 0 ? 0 : value > 1 ? 1 : value;
+}
+
+// adds a node for move as a child of parent and returns it, counting
+// the visit adding it, or returns the node another thread has just added
+// for the same move, or NO_NODE if there's no room; knownHead is the
+// parent's first child when the move wasn't there yet
+static int newNode(Mcts mcts, int parent, int knownHead, LocationID move, PlayerID player)
+{
+    int n = __atomic_fetch_add(&mcts->numNodes, 1, __ATOMIC_RELAXED);
+    if (n >= mcts->maxNodes){
+        return NO_NODE;
+    }
+    //its first visit is the one adding it
+    Node *node = &mcts->nodes[n];
+    node->firstChild = NO_NODE;
+    node->visits = 1;
+    node->available = 1;
+    node->wins = 0;
+    node->move = move;
+    node->player = player;
+    if (parent == NO_NODE){
+        node->nextSibling = NO_NODE;
+        return n;
+    }
+
+    int *head = &mcts->nodes[parent].firstChild;
+    int first = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+    do {
+        int child;
+        for (child = first; child != knownHead; child = mcts->nodes[child].nextSibling){
+            if (mcts->nodes[child].move == move){
+                __atomic_add_fetch(&mcts->nodes[child].visits, 1, __ATOMIC_RELAXED);
+                return child;
+            }
+        }
+        knownHead = first;
+        node->nextSibling = first;
+    } while (!__atomic_compare_exchange_n(head, &first, n, FALSE,
+                                          __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+    return n;
+}
+
+// the root's most visited child, or NO_NODE if it has none
+static int bestChild(Mcts mcts)
+{
+    int best = NO_NODE, bestVisits = 0;
+    int child = __atomic_load_n(&mcts->nodes[mcts->root].firstChild, __ATOMIC_ACQUIRE);
+    for (; child != NO_NODE; child = mcts->nodes[child].nextSibling){
+        int visits = __atomic_load_n(&mcts->nodes[child].visits, __ATOMIC_RELAXED);
+        if (best == NO_NODE || visits > bestVisits){
+            best = child;
+            bestVisits = visits;
+        }
+    }
+    return best;
+}
+
+// registers the best move if it has changed from best, returns it
+static LocationID reportBest(Mcts mcts, LocationID best)
+{
+    int child = bestChild(mcts);
+    if (child != NO_NODE && mcts->nodes[child].move != best){
+        best = mcts->nodes[child].move;
+        registerMove(best);
+    }
+    return best;
+}
+
+// tells the game engine the move is our best so far
+static void registerMove(LocationID move)
+{
+    PlayerMessage message = "";
+    registerBestPlay(idToAbbrev(move), message);
+}
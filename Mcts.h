@@ -0,0 +1,84 @@
+// Mcts.h ... Monte Carlo tree search for the hunters
+//
+// The search is anytime: it keeps running simulations until its time is
+// up, and registers its best move with registerBestPlay() (Game.h) as
+// soon as it starts and again whenever the best move changes, so there
+// is always a move registered whenever it is stopped.
+//
+// Hunters don't know where Dracula has been, so every simulation starts
+// from a different guess at his trail that fits everything they have
+// seen (information set MCTS): unrevealed city and sea moves are filled
+// in with random cities and seas he could have reached, keeping to his
+// trail rules. Searching from a HunterView, the guesses are drawn from
+// its particles instead (see ParticleFilter.h), which fit what the
+// hunters have found or not found as well. The tree is shared between
+// guesses, and a move's score only counts the simulations in which it
+// was legal.
+//
+// Simulations are played on a GameState with applyMove(): a random
+// playout from the leaf, up to a fixed number of moves, scored by who
+// won or, if nobody has yet, by Dracula's blood lost against the score
+// lost. All the tree's nodes are allocated when the Mcts is made, so a
+// search allocates nothing.
+//
+// Given a ThreadPool, every thread of the pool runs simulations on the
+// same tree while the calling thread keeps the registered move up to
+// date, stopping at the deadline.
+//
+// The tree is kept between searches: a search from a position the last
+// one's tree reaches (by the plays made since, as the hunters see them)
+// carries on from the subtree there, and the rest is thrown away. With
+// a pool the search can also carry on in the background after a move
+// is chosen, while the other players take their turns (pondering).
+
+#ifndef MCTS_H
+#define MCTS_H
+
+#include "Globals.h"
+#include "Places.h"
+#include "GameState.h"
+#include "HunterView.h"
+#include "ThreadPool.h"
+
+typedef struct mcts *Mcts;
+
+// a search with room for maxNodes nodes in its tree (it stops growing
+// the tree when they run out); the same seed gives the same searches
+
+Mcts newMcts(int maxNodes, unsigned int seed);
+void disposeMcts(Mcts toBeDeleted);
+
+// searches with every thread of pool from now on, or on the calling
+// thread alone if pool is NULL (the default); the pool is still the
+// caller's to dispose of, after the Mcts is done with it
+
+void mctsSetPool(Mcts mcts, ThreadPool pool);
+
+// searches for the current hunter's best move for msecs milliseconds
+// (timed from the call), registering it as it changes, and returns it
+
+LocationID mctsHunterMove(Mcts mcts, HunterView view, int msecs);
+
+// the same, from a state the hunters could be in (e.g. from
+// giveMeTheState()); the current player must be a hunter
+
+LocationID mctsSearch(Mcts mcts, const GameState *state, int msecs);
+
+// searches in the background from the position after move (the one
+// the last search chose, say) until the next search, which then picks
+// up where it left off if the game went that way; needs a pool
+
+void mctsPonder(Mcts mcts, LocationID move);
+
+// stops searching in the background (the next search or mctsSetPool()
+// does this anyway, and so must happen before the pool is disposed of)
+
+void mctsStopPondering(Mcts mcts);
+
+// how many simulations the last search ran, and
+// how many nodes its tree has
+
+long mctsSimulations(Mcts mcts);
+int mctsNodes(Mcts mcts);
+
+#endif
@@ -0,0 +1,257 @@
+// ParticleFilter.c ... whole trails Dracula could have taken
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "LocationSet.h"
+#include "Random.h"
+#include "GameState.h"
+#include "Plays.h"
+#include "Belief.h"
+#include "Trails.h"
+#include "ParticleFilter.h"
+
+#define TRAIL_MASK     ((1ULL << (8*TRAIL_SIZE)) - 1)
+#define NO_TRAIL       TRAIL_MASK     // every move unknown
+#define DROPPED        (~0ULL)        // a particle that can't have happened
+
+struct particleFilter {
+    uint64_t   *trails;     // byte i: where move i moves ago took him
+    int         capacity;
+    int         count;      // 0 until his first move
+    uint64_t    random;     // xorshift64* state, never 0
+    Belief      fitted;     // the belief the particles were last fitted to
+};
+
+static uint64_t extend(ParticleFilter filter, uint64_t trail, LocationID move,
+                       LocationSet allowed);
+static int fits(uint64_t trail, const Belief *belief);
+static void resample(ParticleFilter filter, const Belief *belief);
+static uint64_t rebuild(ParticleFilter filter, const Belief *belief);
+static uint64_t guess(ParticleFilter filter, const Belief *belief);
+
+static inline LocationID slot(uint64_t trail, int i)
+{
+    return (int8_t)(trail >> (8*i));
+}
+
+ParticleFilter newParticleFilter(int numParticles, unsigned int seed)
+{
+    assert(numParticles > 0);
+    ParticleFilter filter = malloc(sizeof(struct particleFilter));
+    assert(filter != NULL);
+    filter->trails = malloc(numParticles*sizeof(uint64_t));
+    assert(filter->trails != NULL);
+    filter->capacity = numParticles;
+    filter->count = 0;
+    initBelief(&filter->fitted);
+    filter->random = 0x9E3779B97F4A7C15ULL ^ seed;
+    return filter;
+}
+
+void disposeParticleFilter(ParticleFilter toBeDeleted)
+{
+    assert(toBeDeleted != NULL);
+    free(toBeDeleted->trails);
+    free(toBeDeleted);
+}
+
+void copyParticles(ParticleFilter to, ParticleFilter from)
+{
+    int count = from->count < to->capacity ? from->count : to->capacity;
+    memcpy(to->trails, from->trails, count*sizeof(uint64_t));
+    to->count = count;
+    to->fitted = from->fitted;
+}
+
+// moves the particles on with Dracula, or drops the ones a hunter's
+// play rules out, then makes up the numbers again
+void particlePlay(ParticleFilter filter, const Belief *belief, const Play *play)
+{
+    if (play->player == PLAYER_DRACULA){
+        int i;
+        for (i = 0; i < filter->count; i++){
+            filter->trails[i] = extend(filter, filter->trails[i], play->move,
+                                       beliefWhere(belief));
+        }
+        resample(filter, belief);
+    } else if (filter->count > 0 &&
+               memcmp(filter->fitted.where, belief->where, sizeof(belief->where)) != 0){
+        //only if the hunter found something out
+        resample(filter, belief);
+    }
+}
+
+int numParticles(ParticleFilter filter)
+{
+    return filter->count;
+}
+
+uint64_t particleSample(ParticleFilter filter, uint64_t *random)
+{
+    assert(filter->count > 0);
+    return filter->trails[randomBelow(random, filter->count)];
+}
+
+// the particle's places, and the moves as the state has them but with
+// hidden ones made the places they went to
+int particleGuess(ParticleFilter filter, GameState *state, uint64_t *random)
+{
+    if (filter->count == 0){
+        return FALSE;
+    }
+    uint64_t trail = particleSample(filter, random);
+    uint64_t movesWord = 0, whereWord = 0;
+    int i;
+    for (i = TRAIL_SIZE-1; i >= 0; i--){
+        LocationID move = trailMove(state, i);
+        LocationID where = slot(trail, i);
+        if (!validPlace(where)){
+            where = trailWhere(state, i);
+        } else if (move == CITY_UNKNOWN || move == SEA_UNKNOWN){
+            move = where;
+        }
+        movesWord = (movesWord << 8) | (uint8_t)move;
+        whereWord = (whereWord << 8) | (uint8_t)where;
+    }
+    state->trailMoves = movesWord;
+    state->trailWhere = whereWord;
+    state->hash = hashGameState(state);
+    return TRUE;
+}
+
+// the trail with move made from it, to somewhere in allowed, or DROPPED
+// if by his rules the move can't have been made from it
+static uint64_t extend(ParticleFilter filter, uint64_t trail, LocationID move,
+                       LocationSet allowed)
+{
+    if (trail == DROPPED){
+        return DROPPED;
+    }
+    LocationID from = slot(trail, 0);
+    LocationID to = NOWHERE;
+    LocationSet options = allowed;
+    int i;
+    if (move == CITY_UNKNOWN || move == SEA_UNKNOWN){
+        options = setIntersect(options, move == CITY_UNKNOWN ? draculaCities()
+                                                             : draculaSeas());
+        //not back to anywhere still on his trail
+        for (i = 0; i < TRAIL_SIZE-1; i++){
+            if (validPlace(slot(trail, i))){
+                setRemove(&options, slot(trail, i));
+            }
+        }
+    } else if (move == HIDE){
+        to = from;
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+        to = slot(trail, move - DOUBLE_BACK_1);
+    } else if (move == TELEPORT){
+        to = CASTLE_DRACULA;
+        from = NOWHERE;
+    } else {
+        to = move;
+    }
+    if (validPlace(from)){
+        options = setIntersect(options, draculaReach(from));
+    }
+    if (validPlace(to)){
+        //a known place (where a move back to the unknown start of the
+        //trail goes is anywhere allowed)
+        options = setHas(options, to) ? setOf(to) : setEmpty();
+    }
+    if (setIsEmpty(options)){
+        return DROPPED;
+    }
+    to = setNth(options, randomBelow(&filter->random, setSize(options)));
+    return ((trail << 8) | (uint8_t)to) & TRAIL_MASK;
+}
+
+// whether every move of the trail is somewhere the belief allows
+static int fits(uint64_t trail, const Belief *belief)
+{
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        LocationID where = slot(trail, i);
+        if (validPlace(where) && !setHas(beliefTrail(belief, i), where)){
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// keeps the particles that fit the belief at the front, then fills up
+// with copies of them picked at random (or with new ones, if none fit:
+// every trail there is, when there aren't too many to list)
+static void resample(ParticleFilter filter, const Belief *belief)
+{
+    int kept = 0, i;
+    for (i = 0; i < filter->count; i++){
+        uint64_t trail = filter->trails[i];
+        if (trail != DROPPED && fits(trail, belief)){
+            filter->trails[kept++] = trail;
+        }
+    }
+    if (kept == 0){
+        //every trail that fits, if they fit, each as often
+        int numTrails = listTrails(belief, filter->trails, filter->capacity);
+        if (numTrails > 0){
+            for (i = numTrails; i < filter->capacity; i++){
+                filter->trails[i] = filter->trails[i % numTrails];
+            }
+            filter->count = filter->capacity;
+            filter->fitted = *belief;
+            return;
+        }
+        //otherwise as many afresh as a go each makes, and copies of them
+        //for the rest
+        for (i = 0; i < filter->capacity; i++){
+            uint64_t trail = rebuild(filter, belief);
+            if (trail != DROPPED){
+                filter->trails[kept++] = trail;
+            }
+        }
+        if (kept == 0){
+            filter->trails[kept++] = guess(filter, belief);
+        }
+    }
+    for (i = kept; i < filter->capacity; i++){
+        filter->trails[i] = filter->trails[randomBelow(&filter->random, kept)];
+    }
+    filter->count = filter->capacity;
+    filter->fitted = *belief;
+}
+
+// a trail made up move by move from the oldest the belief has, each
+// move to somewhere the belief allows, or DROPPED if it runs into a move
+// that can't be made
+static uint64_t rebuild(ParticleFilter filter, const Belief *belief)
+{
+    uint64_t trail = NO_TRAIL;
+    int i;
+    for (i = TRAIL_SIZE-1; i >= 0 && trail != DROPPED; i--){
+        if (belief->moves[i] != UNKNOWN_LOCATION){
+            trail = extend(filter, trail, belief->moves[i], beliefTrail(belief, i));
+        }
+    }
+    return trail != DROPPED && fits(trail, belief) ? trail : DROPPED;
+}
+
+// just a place the belief allows for each move, for when the plays broke
+// the rules and no trail fits them
+static uint64_t guess(ParticleFilter filter, const Belief *belief)
+{
+    uint64_t trail = NO_TRAIL;
+    int i;
+    for (i = TRAIL_SIZE-1; i >= 0; i--){
+        LocationSet where = beliefTrail(belief, i);
+        LocationID to = NOWHERE;
+        if (!setIsEmpty(where)){
+            to = setNth(where, randomBelow(&filter->random, setSize(where)));
+        }
+        trail = ((trail << 8) | (uint8_t)to) & TRAIL_MASK;
+    }
+    return trail;
+}
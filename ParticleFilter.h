@@ -0,0 +1,76 @@
+// ParticleFilter.h ... whole trails Dracula could have taken
+//
+// A Belief (see Belief.h) says where each move of Dracula's trail could
+// have taken him, one move at a time; it can't say which places go
+// together. A search that plays his trail rules (HIDE and DOUBLE_BACK
+// only to places still on the trail, no going back to them otherwise)
+// needs whole trails that fit everything the hunters have seen, so a
+// ParticleFilter keeps a fixed number of them, particles, and moves them
+// along with him a play at a time:
+//
+//   - his move extends each particle by a place it could have taken him
+//     by his rules (picked at random among them for a C? or S?), and a
+//     particle it couldn't have happened from is dropped
+//   - after every play a particle with any move somewhere the Belief
+//     rules out is dropped too
+//   - the dropped particles are replaced by copies of ones picked at
+//     random from those left (resampling), which then go their own ways
+//     on his next hidden move; if none are left, the particles are made
+//     afresh from the Belief: every trail that fits it (see Trails.h),
+//     if there are no more than there are particles, else random ones
+//
+// A particle is the places of its trail packed a byte each into a word,
+// like GameState's trailWhere, and the particles are one array, so a
+// play's update runs straight along it. Drawing a particle is a random
+// index; the filter is only read, so any number of threads can draw
+// from it at once, each with its own random number state.
+
+#ifndef PARTICLE_FILTER_H
+#define PARTICLE_FILTER_H
+
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "GameState.h"
+#include "Plays.h"
+#include "Belief.h"
+
+// how many particles HunterView keeps
+#define DEFAULT_PARTICLES  1024
+
+typedef struct particleFilter *ParticleFilter;
+
+// a filter of numParticles particles, with nothing known yet; the same
+// seed gives the same particles
+
+ParticleFilter newParticleFilter(int numParticles, unsigned int seed);
+void disposeParticleFilter(ParticleFilter toBeDeleted);
+
+// makes to hold the same particles as from (as many as fit)
+
+void copyParticles(ParticleFilter to, ParticleFilter from);
+
+// updates the particles with one play, given the belief after it (so
+// the belief must be updated with the play first)
+
+void particlePlay(ParticleFilter filter, const Belief *belief, const Play *play);
+
+// how many particles there are (0 before Dracula's first move)
+
+int numParticles(ParticleFilter filter);
+
+// a particle drawn at random: byte i is the place Dracula's move i
+// moves ago took him (0xFF before his first move); random is the
+// caller's xorshift64* state (never 0)
+
+uint64_t particleSample(ParticleFilter filter, uint64_t *random);
+
+// fills in the unrevealed moves of state's trail from a particle drawn
+// at random (a C? or S? becomes the place), as for a search that needs
+// to know where he has been; state must be as the hunters know it, e.g.
+// from giveMeTheState(). Returns FALSE, leaving state alone, if there
+// are no particles.
+
+int particleGuess(ParticleFilter filter, GameState *state, uint64_t *random);
+
+#endif
@@ -91,6 +91,102 @@ static Place places[] =
    {"Zurich", "ZU", ZURICH, LAND},
 };
 
+// Every two character code that can appear in a play, indexed directly by
+// its characters: codeTable[first - 'A'][second - '0'] holds the ID plus
+// one, so that codes not listed are 0 (NOWHERE). Second characters run
+// from '0' to 'Z', which covers the digits, '?' and the letters.
+#define CODE_FIRST_MIN   'A'
+#define CODE_FIRST_MAX   'Z'
+#define CODE_SECOND_MIN  '0'
+#define CODE_SECOND_MAX  'Z'
+#define CODE(a,b,id)     [(a) - CODE_FIRST_MIN][(b) - CODE_SECOND_MIN] = (id) + 1
+
+static const unsigned char codeTable[CODE_FIRST_MAX - CODE_FIRST_MIN + 1]
+                                    [CODE_SECOND_MAX - CODE_SECOND_MIN + 1] =
+{
+   CODE('A','S', ADRIATIC_SEA),
+   CODE('A','L', ALICANTE),
+   CODE('A','M', AMSTERDAM),
+   CODE('A','T', ATHENS),
+   CODE('A','O', ATLANTIC_OCEAN),
+   CODE('B','A', BARCELONA),
+   CODE('B','I', BARI),
+   CODE('B','B', BAY_OF_BISCAY),
+   CODE('B','E', BELGRADE),
+   CODE('B','R', BERLIN),
+   CODE('B','S', BLACK_SEA),
+   CODE('B','O', BORDEAUX),
+   CODE('B','U', BRUSSELS),
+   CODE('B','C', BUCHAREST),
+   CODE('B','D', BUDAPEST),
+   CODE('C','A', CADIZ),
+   CODE('C','G', CAGLIARI),
+   CODE('C','D', CASTLE_DRACULA),
+   CODE('C','F', CLERMONT_FERRAND),
+   CODE('C','O', COLOGNE),
+   CODE('C','N', CONSTANTA),
+   CODE('D','U', DUBLIN),
+   CODE('E','D', EDINBURGH),
+   CODE('E','C', ENGLISH_CHANNEL),
+   CODE('F','L', FLORENCE),
+   CODE('F','R', FRANKFURT),
+   CODE('G','A', GALATZ),
+   CODE('G','W', GALWAY),
+   CODE('G','E', GENEVA),
+   CODE('G','O', GENOA),
+   CODE('G','R', GRANADA),
+   CODE('H','A', HAMBURG),
+   CODE('I','O', IONIAN_SEA),
+   CODE('I','R', IRISH_SEA),
+   CODE('K','L', KLAUSENBURG),
+   CODE('L','E', LE_HAVRE),
+   CODE('L','I', LEIPZIG),
+   CODE('L','S', LISBON),
+   CODE('L','V', LIVERPOOL),
+   CODE('L','O', LONDON),
+   CODE('M','A', MADRID),
+   CODE('M','N', MANCHESTER),
+   CODE('M','R', MARSEILLES),
+   CODE('M','S', MEDITERRANEAN_SEA),
+   CODE('M','I', MILAN),
+   CODE('M','U', MUNICH),
+   CODE('N','A', NANTES),
+   CODE('N','P', NAPLES),
+   CODE('N','S', NORTH_SEA),
+   CODE('N','U', NUREMBURG),
+   CODE('P','A', PARIS),
+   CODE('P','L', PLYMOUTH),
+   CODE('P','R', PRAGUE),
+   CODE('R','O', ROME),
+   CODE('S','A', SALONICA),
+   CODE('S','N', SANTANDER),
+   CODE('S','R', SARAGOSSA),
+   CODE('S','J', SARAJEVO),
+   CODE('S','O', SOFIA),
+   CODE('J','M', ST_JOSEPH_AND_ST_MARYS),
+   CODE('S','T', STRASBOURG),
+   CODE('S','W', SWANSEA),
+   CODE('S','Z', SZEGED),
+   CODE('T','O', TOULOUSE),
+   CODE('T','S', TYRRHENIAN_SEA),
+   CODE('V','A', VALONA),
+   CODE('V','R', VARNA),
+   CODE('V','E', VENICE),
+   CODE('V','I', VIENNA),
+   CODE('Z','A', ZAGREB),
+   CODE('Z','U', ZURICH),
+   // Dracula's special moves
+   CODE('C','?', CITY_UNKNOWN),
+   CODE('S','?', SEA_UNKNOWN),
+   CODE('H','I', HIDE),
+   CODE('D','1', DOUBLE_BACK_1),
+   CODE('D','2', DOUBLE_BACK_2),
+   CODE('D','3', DOUBLE_BACK_3),
+   CODE('D','4', DOUBLE_BACK_4),
+   CODE('D','5', DOUBLE_BACK_5),
+   CODE('T','P', TELEPORT),
+};
+
 // given a Place number, return its name
 char *idToName(LocationID p)
 {
@@ -98,6 +194,13 @@ char *idToName(LocationID p)
    return places[p].name;
 }
 
+// given a Place number, return its abbreviation
+char *idToAbbrev(LocationID p)
+{
+   assert(validPlace(p));
+   return places[p].abbrev;
+}
+
 // given a Place number, return its type
 int idToType(LocationID p)
 {
@@ -123,16 +226,30 @@ int nameToID(char *name)
    return NOWHERE;
 }
 
+// given a move code (2 char), return its ID number
+// as well as places this covers Dracula's special moves (C?, S?, HI, Dn, TP)
+int moveToID(char *abbrev)
+{
+   unsigned char first = abbrev[0] - CODE_FIRST_MIN;
+   unsigned char second = abbrev[1] - CODE_SECOND_MIN;
+   if (first > CODE_FIRST_MAX - CODE_FIRST_MIN ||
+       second > CODE_SECOND_MAX - CODE_SECOND_MIN) return NOWHERE;
+   return (int)codeTable[first][second] - 1;
+}
+
+// given Dracula's trail (most recent first) and one of his moves,
+// return where the move leaves him
+LocationID moveDestination(const LocationID trail[], LocationID move)
+{
+   if (move == HIDE) return trail[0];
+   if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5) return trail[move - DOUBLE_BACK_1];
+   if (move == TELEPORT) return CASTLE_DRACULA;
+   return move;
+}
+
 // given a Place abbreviation (2 char), return its ID number
 int abbrevToID(char *abbrev)
 {
-   // an attempt to optimise a linear search
-   Place *p;
-   Place *first = &places[MIN_MAP_LOCATION];
-   Place *last = &places[MAX_MAP_LOCATION];
-   for (p = first; p <= last; p++) {
-      char *c = p->abbrev;
-      if (c[0] == abbrev[0] && c[1] == abbrev[1] && c[2] == '\0') return p->id;
-   }
-   return NOWHERE;
+   int id = moveToID(abbrev);
+   return validPlace(id) ? id : NOWHERE;
 }
@@ -120,6 +120,9 @@ typedef int LocationID;
 // given a Place number, return its name
 char *idToName(int place);
 
+// given a Place number, return its abbreviation
+char *idToAbbrev(int place);
+
 // given a Place number, return its type
 int idToType(int place);
 
@@ -129,6 +132,14 @@ int nameToID(char *name);
 // given a Place abbreviation, return its ID number
 int abbrevToID(char *abbrev);
 
+// given any code that can appear in a play (a Place abbreviation, or one of
+// C?, S?, HI, D1-D5, TP), return its ID number, or NOWHERE if there isn't one
+int moveToID(char *abbrev);
+
+// given where Dracula's last moves took him (most recent first) and one of
+// his moves (a Place, HI, D1-D5 or TP), return where that move takes him
+LocationID moveDestination(const LocationID trail[], LocationID move);
+
 #define isLand(place)  (idToType(place) == LAND)
 #define isSea(place)  (idToType(place) == SEA)
 
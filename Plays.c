@@ -0,0 +1,154 @@
+// Plays.c ... decoding the play records in a pastPlays string
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#include "Plays.h"
+
+#define SLOT_BITS ((1 << ENCOUNTER_SLOTS) - 1)
+#define PLAY_BATCH 64   // plays decoded at a time
+
+// player character -> PlayerID + 1, so anything else is -1
+static const unsigned char playerTable[256] = {
+    ['G'] = PLAYER_LORD_GODALMING + 1,
+    ['S'] = PLAYER_DR_SEWARD + 1,
+    ['H'] = PLAYER_VAN_HELSING + 1,
+    ['M'] = PLAYER_MINA_HARKER + 1,
+    ['D'] = PLAYER_DRACULA + 1,
+};
+
+static const char encounterChars[NUM_ENCOUNTER_KINDS] = {'T', 'V', 'D', 'M'};
+
+static uint64_t loadPlay(const char *play);
+static int encounterMask(uint64_t word);
+static int classifyVector(const char *plays, int numPlays, int encounters[]);
+
+// number of plays in a pastPlays string (which must start on a play)
+int countPlays(char *plays)
+{
+    return (int)(strlen(plays) + 1) / PLAY_LENGTH;
+}
+
+// decodes the first numPlays plays of the string into decoded[]
+void decodePlays(char *plays, int numPlays, Play decoded[])
+{
+    int encounters[numPlays > 0 ? numPlays : 1];
+    int i;
+
+    // encounters for as many plays as the vector path can take ...
+    i = classifyVector(plays, numPlays, encounters);
+    // ... and the rest a word at a time
+    for (; i < numPlays; i++) {
+        encounters[i] = encounterMask(loadPlay(&plays[i*PLAY_LENGTH]));
+    }
+
+    for (i = 0; i < numPlays; i++) {
+        char *play = &plays[i*PLAY_LENGTH];
+        decoded[i].player = (int)playerTable[(unsigned char)play[0]] - 1;
+        decoded[i].move = moveToID(&play[1]);
+        decoded[i].encounters = encounters[i];
+    }
+}
+
+// decodes the plays a batch at a time
+void forEachPlay(char *plays, PlayFn visit, void *arg)
+{
+    Play batch[PLAY_BATCH];
+    while (plays[0] == ' ') {
+        plays ++;
+    }
+    int remaining = countPlays(plays);
+    while (remaining > 0) {
+        int numPlays = remaining < PLAY_BATCH ? remaining : PLAY_BATCH;
+        decodePlays(plays, numPlays, batch);
+        int i;
+        for (i = 0; i < numPlays; i++) {
+            visit(arg, &batch[i]);
+        }
+        plays += numPlays*PLAY_LENGTH;
+        remaining -= numPlays;
+    }
+}
+
+// the play as a little-endian word, so character i is byte i
+static uint64_t loadPlay(const char *play)
+{
+    uint64_t word;
+    memcpy(&word, play, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+// classifies the four encounter characters of one play using SWAR:
+// for each kind, the bytes equal to its character get their high bit set
+static int encounterMask(uint64_t word)
+{
+    int mask = 0;
+    int kind;
+    for (kind = 0; kind < NUM_ENCOUNTER_KINDS; kind++) {
+        uint64_t x = word ^ (ONES * (unsigned char)encounterChars[kind]);
+        uint64_t zero = ~(((x & LOW7) + LOW7) | x | LOW7) & HIGHS;
+        int bytes = (int)(((zero >> 7) * GATHER) >> 56);
+        mask |= ((bytes >> FIRST_ENCOUNTER) & SLOT_BITS) << (kind*ENCOUNTER_SLOTS);
+    }
+    return mask;
+}
+
+// classifies whole vectors of plays at once, returns how many were done
+static int classifyVector(const char *plays, int numPlays, int encounters[])
+{
+    int done = 0;
+#if defined(__AVX2__)
+    // 4 plays per 32 byte vector
+    __m256i chars[NUM_ENCOUNTER_KINDS];
+    int kind, p;
+    for (kind = 0; kind < NUM_ENCOUNTER_KINDS; kind++) {
+        chars[kind] = _mm256_set1_epi8(encounterChars[kind]);
+    }
+    for (; done + 4 <= numPlays; done += 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)&plays[done*PLAY_LENGTH]);
+        uint32_t bytes[NUM_ENCOUNTER_KINDS];
+        for (kind = 0; kind < NUM_ENCOUNTER_KINDS; kind++) {
+            bytes[kind] = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, chars[kind]));
+        }
+        for (p = 0; p < 4; p++) {
+            int mask = 0;
+            for (kind = 0; kind < NUM_ENCOUNTER_KINDS; kind++) {
+                int slots = (bytes[kind] >> (p*PLAY_LENGTH + FIRST_ENCOUNTER)) & SLOT_BITS;
+                mask |= slots << (kind*ENCOUNTER_SLOTS);
+            }
+            encounters[done + p] = mask;
+        }
+    }
+#elif defined(__SSE2__)
+    // 2 plays per 16 byte vector
+    __m128i chars[NUM_ENCOUNTER_KINDS];
+    int kind, p;
+    for (kind = 0; kind < NUM_ENCOUNTER_KINDS; kind++) {
+        chars[kind] = _mm_set1_epi8(encounterChars[kind]);
+    }
+    for (; done + 2 <= numPlays; done += 2) {
+        __m128i v = _mm_loadu_si128((const __m128i *)&plays[done*PLAY_LENGTH]);
+        int bytes[NUM_ENCOUNTER_KINDS];
+        for (kind = 0; kind < NUM_ENCOUNTER_KINDS; kind++) {
+            bytes[kind] = _mm_movemask_epi8(_mm_cmpeq_epi8(v, chars[kind]));
+        }
+        for (p = 0; p < 2; p++) {
+            int mask = 0;
+            for (kind = 0; kind < NUM_ENCOUNTER_KINDS; kind++) {
+                int slots = (bytes[kind] >> (p*PLAY_LENGTH + FIRST_ENCOUNTER)) & SLOT_BITS;
+                mask |= slots << (kind*ENCOUNTER_SLOTS);
+            }
+            encounters[done + p] = mask;
+        }
+    }
+#endif
+    (void)plays;
+    (void)encounters;
+    return done;
+}
@@ -0,0 +1,63 @@
+// Plays.h ... decoding the play records in a pastPlays string
+//
+// Each play is exactly PLAY_LENGTH characters including the separator:
+//   [player, loc, loc, encounter, encounter, encounter, encounter, ' ']
+// (the last play in the string has '\0' where the space would be), so
+// a play is a single 64-bit word and a run of plays can be decoded a
+// word, or a vector of words, at a time.
+
+#ifndef PLAYS_H
+#define PLAYS_H
+
+#include "Globals.h"
+#include "Places.h"
+
+#define PLAY_LENGTH        8
+#define ENCOUNTER_SLOTS    4
+#define FIRST_ENCOUNTER    3    // index of the first encounter character
+
+// For finding bytes in a word (SWAR): with x = word ^ (ONES * byte),
+//   ~(((x & LOW7) + LOW7) | x | LOW7) & HIGHS
+// has the high bit set in each byte of the word equal to byte, and
+// multiplying that, shifted down 7, by GATHER packs the bits into the top byte
+#define ONES     0x0101010101010101ULL
+#define LOW7     0x7F7F7F7F7F7F7F7FULL
+#define HIGHS    0x8080808080808080ULL
+#define GATHER   0x0102040810204080ULL
+
+// Kinds of encounter character
+#define ENCOUNTER_TRAP     0    // 'T'
+#define ENCOUNTER_VAMPIRE  1    // 'V'
+#define ENCOUNTER_DRACULA  2    // 'D'
+#define ENCOUNTER_MATURED  3    // 'M'
+#define NUM_ENCOUNTER_KINDS 4
+
+typedef struct play {
+    PlayerID   player;      // -1 if the player character isn't recognised
+    LocationID move;        // moveToID() of the location code
+    int        encounters;  // bit (kind*ENCOUNTER_SLOTS + slot) set if the
+                            // encounter in that slot is of that kind
+} Play;
+
+// TRUE if the encounter in slot (0...3) is of the given kind
+#define hasEncounter(play, kind, slot) \
+    (((play)->encounters >> ((kind)*ENCOUNTER_SLOTS + (slot))) & 1)
+
+// number of plays in a pastPlays string (which must start on a play)
+
+int countPlays(char *plays);
+
+// decodes the first numPlays plays of the string into decoded[]
+// reads exactly numPlays*PLAY_LENGTH characters, counting the final '\0'
+
+void decodePlays(char *plays, int numPlays, Play decoded[]);
+
+// what forEachPlay() does with each play
+typedef void (*PlayFn)(void *arg, const Play *play);
+
+// decodes the plays of a pastPlays string (any spaces before the first
+// are skipped), a batch at a time, and calls visit with each in turn
+
+void forEachPlay(char *plays, PlayFn visit, void *arg);
+
+#endif
@@ -0,0 +1,28 @@
+// Random.h ... the xorshift64* random numbers the searches use
+//
+// Each user keeps its own 64-bit state (never 0), so threads and
+// searches never share one and the same seed always gives the same
+// numbers. A number is a few shifts and a multiply, with no calls.
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <stdint.h>
+
+// moves the state on and returns the next 64 random bits
+static inline uint64_t randomNext(uint64_t *random)
+{
+    *random ^= *random >> 12;
+    *random ^= *random << 25;
+    *random ^= *random >> 27;
+    return *random * 0x2545F4914F6CDD1DULL;
+}
+
+// a random number in [0...n-1]
+static inline int randomBelow(uint64_t *random, int n)
+{
+    uint64_t r = randomNext(random);
+    return (int)(((r >> 32) * (uint64_t)n) >> 32);
+}
+
+#endif
@@ -0,0 +1,91 @@
+// Replay.c ... a whole game played back a play at a time, for tests
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Globals.h"
+#include "GameView.h"
+#include "Plays.h"
+#include "GameGen.h"
+#include "Replay.h"
+
+struct replay {
+    char     *plays;          // the whole game, as it was
+    char     *hidden;         // and as the hunters saw it
+    int       numPlays;
+    int       done;           // plays made so far
+    GameView  view;
+    char      next[PLAY_LENGTH];        // the next play, on its own
+    char      nextHidden[PLAY_LENGTH];
+};
+
+static char *copyPlays(char *plays);
+
+Replay newReplay(char *plays)
+{
+    Replay replay = malloc(sizeof(struct replay));
+    assert(replay != NULL);
+    while (plays[0] == ' '){
+        plays ++;
+    }
+    replay->plays = copyPlays(plays);
+    replay->hidden = copyPlays(plays);
+    hideDracula(replay->hidden);
+    replay->numPlays = countPlays(plays);
+    replay->done = 0;
+    replay->view = newGameView("", NULL);
+    return replay;
+}
+
+void disposeReplay(Replay toBeDeleted)
+{
+    disposeGameView(toBeDeleted->view);
+    free(toBeDeleted->plays);
+    free(toBeDeleted->hidden);
+    free(toBeDeleted);
+}
+
+char *replayNext(Replay replay)
+{
+    if (replay->done == replay->numPlays){
+        return NULL;
+    }
+    memcpy(replay->next, &replay->plays[replay->done*PLAY_LENGTH], PLAY_LENGTH-1);
+    replay->next[PLAY_LENGTH-1] = '\0';
+    return replay->next;
+}
+
+char *replayHidden(Replay replay)
+{
+    if (replay->done == replay->numPlays){
+        return NULL;
+    }
+    memcpy(replay->nextHidden, &replay->hidden[replay->done*PLAY_LENGTH], PLAY_LENGTH-1);
+    replay->nextHidden[PLAY_LENGTH-1] = '\0';
+    return replay->nextHidden;
+}
+
+void replayStep(Replay replay)
+{
+    assert(replay->done < replay->numPlays);
+    gameViewAppend(replay->view, replayNext(replay), NULL);
+    replay->done ++;
+}
+
+int replayDone(Replay replay)
+{
+    return replay->done;
+}
+
+GameView replayView(Replay replay)
+{
+    return replay->view;
+}
+
+static char *copyPlays(char *plays)
+{
+    char *copy = malloc(strlen(plays) + 1);
+    assert(copy != NULL);
+    strcpy(copy, plays);
+    return copy;
+}
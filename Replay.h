@@ -0,0 +1,48 @@
+// Replay.h ... a whole game played back a play at a time, for tests
+//
+// Tests that check something against every point of a game (usually one
+// from GameGen) step through its plays with a GameView that knows
+// everything, and often need each play as the hunters saw it too (see
+// hideDracula() in GameGen.h). A Replay does the stepping, so each test
+// only has its own checks to make along the way:
+//
+//   Replay replay = newReplay(game);
+//   while (replayNext(replay) != NULL){
+//       ...replayHidden(replay), before the play...
+//       replayStep(replay);
+//       ...replayView(replay), after it...
+//   }
+//   disposeReplay(replay);
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "Globals.h"
+#include "GameView.h"
+
+typedef struct replay *Replay;
+
+// a replay of the plays in a pastPlays string (copied), with none made yet
+
+Replay newReplay(char *plays);
+void disposeReplay(Replay toBeDeleted);
+
+// the next play on its own, as a pastPlays string, or NULL once every
+// play has been made; replayHidden() gives it as the hunters saw it
+
+char *replayNext(Replay replay);
+char *replayHidden(Replay replay);
+
+// makes the next play in the replay's view
+
+void replayStep(Replay replay);
+
+// how many plays have been made
+
+int replayDone(Replay replay);
+
+// the game as far as it has been played, knowing everything
+
+GameView replayView(Replay replay);
+
+#endif
@@ -0,0 +1,140 @@
+// Rollout.c ... fast random playouts from a GameState
+
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "Places.h"
+#include "Map.h"
+#include "LocationSet.h"
+#include "GameState.h"
+#include "Belief.h"
+#include "Random.h"
+#include "Rollout.h"
+
+// where a hunter can get to from each place for each number of rail
+// hops, staying put included; the Map's sets joined up once so a move is
+// a single look-up (Belief keeps Dracula's)
+static LocationSet hunterReach[NUM_MAP_LOCATIONS][MAX_RAIL_HOPS+1];
+static pthread_once_t tablesMade = PTHREAD_ONCE_INIT;
+
+static void makeTables(void);
+static LocationID randomHunterMove(const GameState *state, uint64_t *random,
+                                   int heuristic);
+static LocationID randomDraculaMove(const GameState *state, uint64_t *random,
+                                    int heuristic);
+
+LocationID randomMove(const GameState *state, uint64_t *random, int heuristic)
+{
+    pthread_once(&tablesMade, makeTables);
+    if (state->curr == PLAYER_DRACULA){
+        return randomDraculaMove(state, random, heuristic);
+    }
+    return randomHunterMove(state, random, heuristic);
+}
+
+int playout(GameState *state, uint64_t *random, int maxMoves, int heuristic)
+{
+    pthread_once(&tablesMade, makeTables);
+    int played;
+    for (played = 0; played != maxMoves && !isGameOver(state); played++){
+        Undo undo;
+        applyMove(state, randomMove(state, random, heuristic), &undo);
+    }
+    return played;
+}
+
+// one of the places hunterMoves() would list
+static LocationID randomHunterMove(const GameState *state, uint64_t *random,
+                                   int heuristic)
+{
+    LocationID from = state->location[state->curr];
+    if (from == UNKNOWN_LOCATION){
+        return randomBelow(random, NUM_MAP_LOCATIONS);
+    }
+    LocationSet reachable = hunterReach[from][(state->curr + state->round) % 4];
+
+    LocationID dracula = trailWhere(state, 0);
+    if (heuristic && validPlace(dracula) && setHas(reachable, dracula)){
+        return dracula;
+    }
+    return setNth(reachable, randomBelow(random, setSize(reachable)));
+}
+
+// one of the moves draculaMoves() would list: the places are picked
+// from a set of them and the rest from a set of move codes
+static LocationID randomDraculaMove(const GameState *state, uint64_t *random,
+                                    int heuristic)
+{
+    LocationID whereAmI = trailWhere(state, 0);
+    if (whereAmI == UNKNOWN_LOCATION){
+        LocationSet anywhere = setAll();
+        setRemove(&anywhere, ST_JOSEPH_AND_ST_MARYS);
+        return setNth(anywhere, randomBelow(random, setSize(anywhere)));
+    }
+
+    assert(validPlace(whereAmI));
+    LocationSet adjacent = draculaReach(whereAmI);
+
+    //move codes (HIDE and up) fit in the same 128 bits as places
+    LocationSet inTrail = setEmpty();
+    LocationSet special = setEmpty();
+    int hid = FALSE, doubledBack = FALSE;
+    int i;
+    for (i = 0; i < TRAIL_SIZE-1; i++){
+        LocationID move = trailMove(state, i);
+        LocationID where = trailWhere(state, i);
+        hid |= move == HIDE;
+        doubledBack |= move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5;
+        if (validPlace(where)){
+            setAdd(&inTrail, where);
+            if (setHas(adjacent, where)){
+                setAdd(&special, DOUBLE_BACK_1 + i);
+            }
+        }
+    }
+    if (doubledBack){
+        special = setEmpty();
+    }
+    if (!hid && !setHas(draculaSeas(), whereAmI)){
+        setAdd(&special, HIDE);
+    }
+    LocationSet places = setMinus(adjacent, inTrail);
+    if (heuristic){
+        LocationSet hunters = setEmpty();
+        int h;
+        for (h = 0; h < NUM_HUNTERS; h++){
+            if (validPlace(state->location[h])){
+                setAdd(&hunters, state->location[h]);
+            }
+        }
+        LocationSet safe = setMinus(places, hunters);
+        if (!setIsEmpty(safe)){
+            places = safe;
+            special = setEmpty();
+        }
+    }
+
+    int numPlaces = setSize(places);
+    int numMoves = numPlaces + setSize(special);
+    if (numMoves == 0){
+        return TELEPORT;
+    }
+    int n = randomBelow(random, numMoves);
+    return n < numPlaces ? setNth(places, n) : setNth(special, n - numPlaces);
+}
+
+static void makeTables(void)
+{
+    Map map = newMap();
+    LocationID from;
+    for (from = MIN_MAP_LOCATION; from <= MAX_MAP_LOCATION; from++){
+        LocationSet adjacent = setUnion(connectionSet(map, from, ROAD),
+                                        connectionSet(map, from, BOAT));
+        setAdd(&adjacent, from);
+        int hops;
+        for (hops = 0; hops <= MAX_RAIL_HOPS; hops++){
+            hunterReach[from][hops] = setUnion(adjacent, railReachable(map, from, hops));
+        }
+    }
+}
@@ -0,0 +1,37 @@
+// Rollout.h ... fast random playouts from a GameState
+//
+// A playout picks each player's move at random (uniformly from the
+// legal moves, as legalMoves() would list them) and plays it with
+// applyMove(). Moves are picked straight from the bitset tables (the
+// road, sea and rail LocationSets of Map.h and a set of Dracula's move
+// codes), without listing them out, and nothing is allocated: a playout
+// needs only its GameState and a random number state, both the caller's,
+// so any number of threads can run playouts at once.
+//
+// With heuristic set the players aren't quite random: a hunter who can
+// reach Dracula goes there, and Dracula keeps off hunters' cities when
+// he can.
+
+#ifndef ROLLOUT_H
+#define ROLLOUT_H
+
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "GameState.h"
+
+// for maxMoves, to play until the game is over
+#define PLAYOUT_TO_END   -1
+
+// a random legal move for the current player of state (whose trail
+// must be known, as in a guessed trail); random is the generator's
+// state and must not be 0
+
+LocationID randomMove(const GameState *state, uint64_t *random, int heuristic);
+
+// plays random moves from state until the game is over or maxMoves
+// have been played, returns how many were played
+
+int playout(GameState *state, uint64_t *random, int maxMoves, int heuristic);
+
+#endif
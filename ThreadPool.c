@@ -0,0 +1,250 @@
+// ThreadPool.c ... a work-stealing pool of threads for parallel search
+//
+// Deques are short arrays used as rings, each with its own lock, which
+// only its owner and the odd thief ever take. Tasks here are meant to be
+// coarse (many simulations or a subtree each), so the locks are rarely
+// contended; a deque that fills up just runs the task straight away.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "ThreadPool.h"
+
+#define DEQUE_SIZE   1024
+
+typedef struct task {
+    TaskFn run;
+    void  *arg;
+} Task;
+
+typedef struct deque {
+    pthread_mutex_t lock;
+    long top;                  // oldest task, where thieves take from
+    long bottom;               // one past the newest, where the owner works
+    Task tasks[DEQUE_SIZE];
+} Deque;
+
+typedef struct worker {
+    ThreadPool pool;
+    int        id;
+    pthread_t  thread;
+} Worker;
+
+struct threadPool {
+    int             numThreads;
+    Worker         *workers;
+    Deque          *deques;
+    int             queued;     // tasks sitting in deques
+    int             pending;    // tasks submitted and not finished
+    unsigned int    nextDeque;  // where tasks from outside the pool go
+    int             stopping;
+    pthread_mutex_t lock;       // for sleeping on these:
+    pthread_cond_t  work;       //   something has been queued
+    pthread_cond_t  idle;       //   pending has reached 0
+};
+
+// which of its pool's threads this is, -1 if it isn't one
+static __thread int workerId = -1;
+static __thread ThreadPool workerPool = NULL;
+
+static void *runWorker(void *arg);
+static int pushTask(Deque *deque, Task task);
+static int popTask(Deque *deque, Task *task);
+static int stealTask(Deque *deque, Task *task);
+static void finishTask(ThreadPool pool);
+
+// a pool of numThreads threads, or one per core if numThreads is 0
+ThreadPool newThreadPool(int numThreads)
+{
+    if (numThreads <= 0){
+        numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        if (numThreads < 1) numThreads = 1;
+    }
+    ThreadPool pool = malloc(sizeof(struct threadPool));
+    assert(pool != NULL);
+    pool->numThreads = numThreads;
+    pool->workers = malloc(numThreads*sizeof(Worker));
+    pool->deques = malloc(numThreads*sizeof(Deque));
+    assert(pool->workers != NULL && pool->deques != NULL);
+    pool->queued = 0;
+    pool->pending = 0;
+    pool->nextDeque = 0;
+    pool->stopping = FALSE;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    int i;
+    for (i = 0; i < numThreads; i++){
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+        pool->deques[i].top = 0;
+        pool->deques[i].bottom = 0;
+    }
+    for (i = 0; i < numThreads; i++){
+        pool->workers[i].pool = pool;
+        pool->workers[i].id = i;
+        pthread_create(&pool->workers[i].thread, NULL, runWorker, &pool->workers[i]);
+    }
+    return pool;
+}
+
+// waits for every task to finish, then stops the threads
+void disposeThreadPool(ThreadPool toBeDeleted)
+{
+    poolWait(toBeDeleted);
+    pthread_mutex_lock(&toBeDeleted->lock);
+    toBeDeleted->stopping = TRUE;
+    pthread_cond_broadcast(&toBeDeleted->work);
+    pthread_mutex_unlock(&toBeDeleted->lock);
+
+    //the others can still look in a deque until they have all stopped
+    int i;
+    for (i = 0; i < toBeDeleted->numThreads; i++){
+        pthread_join(toBeDeleted->workers[i].thread, NULL);
+    }
+    for (i = 0; i < toBeDeleted->numThreads; i++){
+        pthread_mutex_destroy(&toBeDeleted->deques[i].lock);
+    }
+    pthread_mutex_destroy(&toBeDeleted->lock);
+    pthread_cond_destroy(&toBeDeleted->work);
+    pthread_cond_destroy(&toBeDeleted->idle);
+    free(toBeDeleted->deques);
+    free(toBeDeleted->workers);
+    free(toBeDeleted);
+}
+
+// number of threads in the pool
+int poolThreads(ThreadPool pool)
+{
+    return pool->numThreads;
+}
+
+// queues run(arg) to be run by one of the threads
+void poolSubmit(ThreadPool pool, TaskFn run, void *arg)
+{
+    Task task = {run, arg};
+    __atomic_add_fetch(&pool->pending, 1, __ATOMIC_SEQ_CST);
+
+    //a thread of the pool keeps its own work, anyone else spreads it out
+    int d;
+    if (workerPool == pool){
+        d = workerId;
+    } else {
+        d = __atomic_fetch_add(&pool->nextDeque, 1, __ATOMIC_RELAXED) % pool->numThreads;
+    }
+    if (!pushTask(&pool->deques[d], task)){
+        run(arg);
+        finishTask(pool);
+        return;
+    }
+
+    __atomic_add_fetch(&pool->queued, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// waits until every task submitted so far has finished
+void poolWait(ThreadPool pool)
+{
+    assert(workerPool != pool);
+    pthread_mutex_lock(&pool->lock);
+    while (__atomic_load_n(&pool->pending, __ATOMIC_SEQ_CST) > 0){
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// a thread of the pool: runs its own tasks, steals, or sleeps
+static void *runWorker(void *arg)
+{
+    Worker *worker = arg;
+    ThreadPool pool = worker->pool;
+    workerId = worker->id;
+    workerPool = pool;
+    unsigned int random = (unsigned int)worker->id*2654435761U + 1;
+
+    for (;;){
+        Task task;
+        int found = popTask(&pool->deques[workerId], &task);
+        //try everyone else, starting from a random thread
+        int i;
+        random = random*1103515245U + 12345U;
+        int victim = (random >> 16) % pool->numThreads;
+        for (i = 0; i < pool->numThreads && !found; i++){
+            int d = (victim + i) % pool->numThreads;
+            if (d != workerId){
+                found = stealTask(&pool->deques[d], &task);
+            }
+        }
+        if (found){
+            __atomic_sub_fetch(&pool->queued, 1, __ATOMIC_SEQ_CST);
+            task.run(task.arg);
+            finishTask(pool);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        while (__atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST) == 0 && !pool->stopping){
+            pthread_cond_wait(&pool->work, &pool->lock);
+        }
+        int stop = pool->stopping && __atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST) == 0;
+        pthread_mutex_unlock(&pool->lock);
+        if (stop){
+            break;
+        }
+    }
+    return NULL;
+}
+
+// adds a task at the bottom, FALSE if the deque is full
+static int pushTask(Deque *deque, Task task)
+{
+    pthread_mutex_lock(&deque->lock);
+    int pushed = deque->bottom - deque->top < DEQUE_SIZE;
+    if (pushed){
+        deque->tasks[deque->bottom % DEQUE_SIZE] = task;
+        deque->bottom ++;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return pushed;
+}
+
+// takes the newest task, for the owner
+static int popTask(Deque *deque, Task *task)
+{
+    pthread_mutex_lock(&deque->lock);
+    int popped = deque->bottom > deque->top;
+    if (popped){
+        deque->bottom --;
+        *task = deque->tasks[deque->bottom % DEQUE_SIZE];
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return popped;
+}
+
+// takes the oldest task, for thieves
+static int stealTask(Deque *deque, Task *task)
+{
+    pthread_mutex_lock(&deque->lock);
+    int stolen = deque->bottom > deque->top;
+    if (stolen){
+        *task = deque->tasks[deque->top % DEQUE_SIZE];
+        deque->top ++;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return stolen;
+}
+
+// counts a task as done, waking poolWait() if it was the last
+static void finishTask(ThreadPool pool)
+{
+    if (__atomic_sub_fetch(&pool->pending, 1, __ATOMIC_SEQ_CST) == 0){
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_broadcast(&pool->idle);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
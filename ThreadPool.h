@@ -0,0 +1,39 @@
+// ThreadPool.h ... a work-stealing pool of threads for parallel search
+//
+// Each thread has its own deque of tasks. A thread runs the newest task
+// on its own deque first (tasks submitted from inside a task go there),
+// and when that is empty steals the oldest task from another thread's
+// deque, trying them from a random one. Threads with nothing to do sleep
+// until something is submitted.
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+typedef void (*TaskFn)(void *arg);
+
+typedef struct threadPool *ThreadPool;
+
+// a pool of numThreads threads, or one per core if numThreads is 0
+
+ThreadPool newThreadPool(int numThreads);
+
+// waits for every task to finish, then stops the threads
+
+void disposeThreadPool(ThreadPool toBeDeleted);
+
+// number of threads in the pool
+
+int poolThreads(ThreadPool pool);
+
+// queues run(arg) to be run by one of the threads
+// Can be called from inside a task, e.g. to split work up or to carry on
+// with it later.
+
+void poolSubmit(ThreadPool pool, TaskFn run, void *arg);
+
+// waits until every task submitted so far, and every task they submit,
+// has finished (not for calling from inside a task)
+
+void poolWait(ThreadPool pool);
+
+#endif
@@ -0,0 +1,66 @@
+// TimeBudget.c ... keeping a search inside its time
+
+#include <time.h>
+#include "Globals.h"
+#include "TimeBudget.h"
+
+// how much more an iteration is guessed to cost than the one before:
+// when there's only one to go on, and at least and at most otherwise
+#define FIRST_GROWTH   4
+#define MIN_GROWTH     1
+#define MAX_GROWTH     16
+
+long budgetNow(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec*1000000000L + t.tv_nsec;
+}
+
+void budgetStart(TimeBudget *budget, int msecs)
+{
+    budget->start = budgetNow();
+    budget->deadline = budget->start + msecs*1000000L;
+    budget->iterationStart = budget->start;
+    budget->lastCost = 0;
+    budget->previousCost = 0;
+}
+
+int budgetExpired(const TimeBudget *budget)
+{
+    return budgetNow() >= budget->deadline;
+}
+
+long budgetRemaining(const TimeBudget *budget)
+{
+    long left = budget->deadline - budgetNow();
+    return left > 0 ? left : 0;
+}
+
+void budgetIterationStarted(TimeBudget *budget)
+{
+    budget->iterationStart = budgetNow();
+}
+
+void budgetIterationDone(TimeBudget *budget)
+{
+    budget->previousCost = budget->lastCost;
+    budget->lastCost = budgetNow() - budget->iterationStart;
+}
+
+// the last iteration's time, grown by the last growth (within limits)
+long budgetNextCost(const TimeBudget *budget)
+{
+    if (budget->previousCost <= 0){
+        return budget->lastCost*FIRST_GROWTH;
+    }
+    double growth = (double)budget->lastCost / budget->previousCost;
+    if (growth < MIN_GROWTH) growth = MIN_GROWTH;
+    if (growth > MAX_GROWTH) growth = MAX_GROWTH;
+    return (long)(budget->lastCost*growth);
+}
+
+int budgetAllowsNext(const TimeBudget *budget)
+{
+    return budgetNow() + budgetNextCost(budget) < budget->deadline;
+}
@@ -0,0 +1,61 @@
+// TimeBudget.h ... keeping a search inside its time
+//
+// The engine's limit (LIMIT_LIMIT_MSECS in Game.h) is hard: a player
+// still running at the limit loses its turn. A TimeBudget times a
+// search on the monotonic clock (so changes to the time of day can't
+// stretch or shrink it) against a deadline set when it starts.
+//
+// Searches that work in iterations (a ply deeper each time, or a batch
+// of simulations) tell the budget when each starts and finishes, and
+// the budget guesses what the next will cost from the last two: there
+// is no point starting one that can't finish in time, as its work
+// would be thrown away, but the search shouldn't stop while there's
+// time for one either. budgetExpired() is for the search to stop
+// part way through an iteration when the guess was wrong.
+
+#ifndef TIME_BUDGET_H
+#define TIME_BUDGET_H
+
+// how long before the engine's limit the players aim to finish, for
+// the time it takes to stop, clean up and return
+#define BUDGET_SAFETY_MSECS   100
+
+typedef struct timeBudget {
+    long start;           // all times in nanoseconds on the monotonic clock
+    long deadline;
+    long iterationStart;
+    long lastCost;        // what the last two iterations took, 0 if there
+    long previousCost;    //   haven't been that many
+} TimeBudget;
+
+// the monotonic clock now, in nanoseconds
+
+long budgetNow(void);
+
+// starts a budget of msecs milliseconds from now
+
+void budgetStart(TimeBudget *budget, int msecs);
+
+// TRUE once the deadline has passed
+
+int budgetExpired(const TimeBudget *budget);
+
+// nanoseconds left until the deadline (0 once it has passed)
+
+long budgetRemaining(const TimeBudget *budget);
+
+// marks an iteration starting and finishing
+
+void budgetIterationStarted(TimeBudget *budget);
+void budgetIterationDone(TimeBudget *budget);
+
+// what the next iteration will probably take, in nanoseconds: the last
+// one's time, grown by as much as it grew on the one before
+
+long budgetNextCost(const TimeBudget *budget);
+
+// TRUE if the next iteration should finish before the deadline
+
+int budgetAllowsNext(const TimeBudget *budget);
+
+#endif
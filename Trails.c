@@ -0,0 +1,238 @@
+// Trails.c ... every trail Dracula could have taken, exactly
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "LocationSet.h"
+#include "Belief.h"
+#include "Trails.h"
+
+#define TRAIL_MASK  ((1ULL << (8*TRAIL_SIZE)) - 1)
+#define NO_TRAIL    TRAIL_MASK      // every move unknown
+#define MEMO_SIZE   4096            // states remembered (a power of 2)
+#define MEMO_PROBES 8               // places looked in for a state
+
+// a state of a trail part filled in, as far as finishing it goes
+typedef struct key {
+    LocationSet used;      // the places on the trail so far
+    uint64_t    backTo;    // the places later double backs go back to
+    int8_t      move;      // the move filled in last
+    int8_t      where;     // where it took him
+} Key;
+
+typedef struct memo {
+    Key   key;
+    long  ways;            // trails finishing from the state
+    int   filled;
+} Memo;
+
+typedef struct search {
+    const Belief *belief;
+    LocationSet   leads[TRAIL_SIZE];  // places each move can lead on from
+    uint64_t      backMask;           // bytes of the moves doubled back to
+    int           oldest;             // the oldest move known
+    long          maxTrails;
+    Memo         *memo;               // NULL when listing
+    uint64_t     *trails;             // NULL when counting
+    int           numTrails;
+} Search;
+
+static int startSearch(Search *search, const Belief *belief, long maxTrails);
+static LocationSet candidates(const Search *search, int i, uint64_t trail,
+                              LocationSet used);
+static long countFrom(Search *search, int i, uint64_t trail, LocationSet used);
+static int listFrom(Search *search, int i, uint64_t trail, LocationSet used);
+static Memo *findMemo(Search *search, const Key *key);
+
+static inline LocationID slot(uint64_t trail, int i)
+{
+    return (int8_t)(trail >> (8*i));
+}
+
+static inline uint64_t setSlot(uint64_t trail, int i, LocationID where)
+{
+    return (trail & ~(0xFFULL << (8*i))) | ((uint64_t)(uint8_t)where << (8*i));
+}
+
+long countTrails(const Belief *belief, long maxTrails)
+{
+    Search search;
+    if (!startSearch(&search, belief, maxTrails)){
+        return 0;
+    }
+    search.memo = calloc(MEMO_SIZE, sizeof(Memo));
+    assert(search.memo != NULL);
+    long ways = countFrom(&search, search.oldest, NO_TRAIL, setEmpty());
+    free(search.memo);
+    return ways > maxTrails ? TOO_MANY_TRAILS : ways;
+}
+
+int listTrails(const Belief *belief, uint64_t trails[], int maxTrails)
+{
+    Search search;
+    if (!startSearch(&search, belief, maxTrails)){
+        return 0;
+    }
+    search.trails = trails;
+    if (!listFrom(&search, search.oldest, NO_TRAIL, setEmpty())){
+        return TOO_MANY_TRAILS;
+    }
+    return search.numTrails;
+}
+
+// sets up a search, with where each move can lead on from worked out
+// back from the latest; FALSE if Dracula hasn't moved yet
+static int startSearch(Search *search, const Belief *belief, long maxTrails)
+{
+    search->belief = belief;
+    search->maxTrails = maxTrails;
+    search->memo = NULL;
+    search->trails = NULL;
+    search->numTrails = 0;
+    search->backMask = 0;
+    search->oldest = -1;
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++){
+        LocationID move = belief->moves[i];
+        if (move == UNKNOWN_LOCATION){
+            break;
+        }
+        search->oldest = i;
+        if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+            int back = i + move - DOUBLE_BACK_1 + 1;
+            if (back < TRAIL_SIZE){
+                search->backMask |= 0xFFULL << (8*back);
+            }
+        }
+    }
+    if (search->oldest < 0){
+        return FALSE;
+    }
+
+    //a place can lead on if the next move can be made from it to a
+    //place that leads on
+    search->leads[0] = beliefTrail(belief, 0);
+    for (i = 1; i <= search->oldest; i++){
+        LocationID next = belief->moves[i-1];
+        LocationSet from;
+        if (next == HIDE){
+            from = search->leads[i-1];
+        } else if (next == TELEPORT){
+            from = setAll();
+        } else {
+            from = draculaReachable(search->leads[i-1]);
+        }
+        search->leads[i] = setIntersect(beliefTrail(belief, i), from);
+    }
+    return TRUE;
+}
+
+// the places move i could have taken him, given the older moves in trail
+// (and the places they went, used), that can lead on to the later moves
+static LocationSet candidates(const Search *search, int i, uint64_t trail,
+                              LocationSet used)
+{
+    LocationID move = search->belief->moves[i];
+    LocationID from = i < search->oldest ? slot(trail, i+1) : NOWHERE;
+    LocationSet options = search->leads[i];
+    LocationID to = NOWHERE;
+    if (move == CITY_UNKNOWN || move == SEA_UNKNOWN){
+        options = setMinus(options, used);
+    } else if (move == HIDE){
+        to = from;
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+        int back = i + move - DOUBLE_BACK_1 + 1;
+        to = back <= search->oldest ? slot(trail, back) : NOWHERE;
+    } else if (move == TELEPORT){
+        return setIntersect(options, setOf(CASTLE_DRACULA));
+    } else {
+        to = move;
+    }
+    if (validPlace(from)){
+        options = setIntersect(options, draculaReachable(setOf(from)));
+    }
+    if (validPlace(to)){
+        options = setIntersect(options, setOf(to));
+    }
+    return options;
+}
+
+// the number of ways to fill in moves i...0, or more than maxTrails if
+// there turn out to be too many to finish counting
+static long countFrom(Search *search, int i, uint64_t trail, LocationSet used)
+{
+    if (i < 0){
+        return 1;
+    }
+    Key key;
+    memset(&key, 0, sizeof(Key));
+    Memo *memo = NULL;
+    if (i < search->oldest){
+        key.used = used;
+        key.backTo = trail & search->backMask;
+        key.move = i+1;
+        key.where = slot(trail, i+1);
+        memo = findMemo(search, &key);
+        if (memo != NULL && memo->filled){
+            return memo->ways;
+        }
+    }
+    long ways = 0;
+    LocationSet options = candidates(search, i, trail, used);
+    while (!setIsEmpty(options) && ways <= search->maxTrails){
+        LocationID where = setPopFirst(&options);
+        LocationSet nowUsed = used;
+        setAdd(&nowUsed, where);
+        ways += countFrom(search, i-1, setSlot(trail, i, where), nowUsed);
+    }
+    if (memo != NULL && ways <= search->maxTrails){
+        memo->key = key;
+        memo->ways = ways;
+        memo->filled = TRUE;
+    }
+    return ways;
+}
+
+// lists the ways to fill in moves i...0; FALSE once there are too many
+static int listFrom(Search *search, int i, uint64_t trail, LocationSet used)
+{
+    if (i < 0){
+        if (search->numTrails == search->maxTrails){
+            return FALSE;
+        }
+        search->trails[search->numTrails++] = trail;
+        return TRUE;
+    }
+    LocationSet options = candidates(search, i, trail, used);
+    while (!setIsEmpty(options)){
+        LocationID where = setPopFirst(&options);
+        LocationSet nowUsed = used;
+        setAdd(&nowUsed, where);
+        if (!listFrom(search, i-1, setSlot(trail, i, where), nowUsed)){
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// the entry remembering key, or an empty one for it, or NULL if there's
+// no room left near where it goes
+static Memo *findMemo(Search *search, const Key *key)
+{
+    uint64_t h = key->used.bits[0] * 0x9E3779B97F4A7C15ULL;
+    h ^= key->used.bits[1] * 0xC2B2AE3D27D4EB4FULL;
+    h ^= key->backTo * 0x165667B19E3779F9ULL;
+    h ^= (uint64_t)(uint8_t)key->move << 8 | (uint8_t)key->where;
+    h ^= h >> 29;
+    int probe;
+    for (probe = 0; probe < MEMO_PROBES; probe++){
+        Memo *memo = &search->memo[(h + probe) & (MEMO_SIZE - 1)];
+        if (!memo->filled || memcmp(&memo->key, key, sizeof(Key)) == 0){
+            return memo;
+        }
+    }
+    return NULL;
+}
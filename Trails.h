@@ -0,0 +1,45 @@
+// Trails.h ... every trail Dracula could have taken, exactly
+//
+// A Belief (see Belief.h) has where each of the last TRAIL_SIZE moves of
+// Dracula's trail could have taken him, from all the moves in pastPlays
+// (C?, S?, HI, Dn, TP and revealed places) and everything the hunters
+// have run into. These count or list the whole trails that fit it and
+// his rules: each move by road or sea from the one before, a C? or S?
+// never back to a place still on the trail, HIDE staying put and Dn
+// going back to where the move n before went.
+//
+// The trail is filled in from its oldest move. Before that, a pass back
+// from the latest move works out for each move the set of places it
+// could have been and still have every later move possible (a set at a
+// time, with the byte tables of draculaReachable()), so only places
+// that can lead somewhere are tried. Counting remembers how many ways
+// there are to finish a trail from each state it reaches: the move,
+// where he is, the places already on the trail (which every later C? or
+// S? must keep away from, whatever order they came in) and the places
+// a later Dn goes back to. Both stop as soon as there are more trails
+// than the caller wants, so a hopelessly vague belief costs little.
+
+#ifndef TRAILS_H
+#define TRAILS_H
+
+#include <stdint.h>
+#include "Globals.h"
+#include "Places.h"
+#include "Belief.h"
+
+// returned when there are more trails than asked for
+#define TOO_MANY_TRAILS  -1
+
+// the number of trails that fit the belief, or TOO_MANY_TRAILS if there
+// are more than maxTrails
+
+long countTrails(const Belief *belief, long maxTrails);
+
+// writes the trails that fit the belief into trails and returns how many
+// there are, or TOO_MANY_TRAILS (with trails filled up) if there are more
+// than maxTrails; byte i of a trail is the place Dracula's move i moves
+// ago took him (0xFF before his first move), as particleSample() gives
+
+int listTrails(const Belief *belief, uint64_t trails[], int maxTrails);
+
+#endif
@@ -0,0 +1,120 @@
+// TransTable.c ... a transposition table of searched positions
+//
+// Entries are shared between search threads without locks. Each is two
+// words, each read and written atomically: the data (value, move, depth,
+// bound and age packed together) and the hash XORed with the data. Two
+// threads storing to one entry at once can leave it with one's data and
+// the other's check word, but then the check word doesn't XOR back to
+// the hash of either, so ttProbe() just doesn't find it.
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Globals.h"
+#include "TransTable.h"
+
+#define BOUND_BITS   2
+#define BOUND_MASK   ((1 << BOUND_BITS) - 1)
+#define MAX_DEPTH    255
+
+// where each field is in an entry's data word
+#define VALUE_SHIFT  0
+#define MOVE_SHIFT   32
+#define DEPTH_SHIFT  48
+#define INFO_SHIFT   56
+
+// 16 bytes, so four share a cache line
+typedef struct ttEntry {
+    uint64_t check;      // the hash XOR data
+    uint64_t data;
+} TTEntry;
+
+struct transTable {
+    TTEntry *entries;
+    uint64_t mask;       // number of entries - 1
+    uint8_t  age;        // the current search, in the bits above the bound
+};
+
+static uint64_t packData(int depth, int value, int bound, LocationID move, int age);
+
+// a table of 2^log2Entries entries, all empty
+TransTable newTransTable(int log2Entries)
+{
+    assert(log2Entries > 0 && log2Entries < 40);
+    TransTable table = malloc(sizeof(struct transTable));
+    assert(table != NULL);
+    table->mask = ((uint64_t)1 << log2Entries) - 1;
+    table->entries = calloc(table->mask + 1, sizeof(TTEntry));
+    assert(table->entries != NULL);
+    table->age = 0;
+    return table;
+}
+
+void disposeTransTable(TransTable toBeDeleted)
+{
+    free(toBeDeleted->entries);
+    free(toBeDeleted);
+}
+
+// empties the table
+void ttClear(TransTable table)
+{
+    memset(table->entries, 0, (table->mask + 1)*sizeof(TTEntry));
+    table->age = 0;
+}
+
+// starts a new search
+void ttNewSearch(TransTable table)
+{
+    //the age wraps around in the bits above the bound
+    table->age += 1 << BOUND_BITS;
+}
+
+// looks the position up
+int ttProbe(TransTable table, uint64_t key, int *depth, int *value,
+            int *bound, LocationID *move)
+{
+    TTEntry *entry = &table->entries[key & table->mask];
+    uint64_t check = __atomic_load_n(&entry->check, __ATOMIC_RELAXED);
+    uint64_t data = __atomic_load_n(&entry->data, __ATOMIC_RELAXED);
+    //(an empty entry is all zeros, so would only match a hash of zero)
+    if ((check ^ data) != key){
+        return FALSE;
+    }
+    *value = (int32_t)(data >> VALUE_SHIFT);
+    *move = (int16_t)(data >> MOVE_SHIFT);
+    *depth = (uint8_t)(data >> DEPTH_SHIFT);
+    *bound = (data >> INFO_SHIFT) & BOUND_MASK;
+    return TRUE;
+}
+
+// stores what a search of depth plies found for the position
+void ttStore(TransTable table, uint64_t key, int depth, int value,
+             int bound, LocationID move)
+{
+    TTEntry *entry = &table->entries[key & table->mask];
+    uint64_t check = __atomic_load_n(&entry->check, __ATOMIC_RELAXED);
+    uint64_t data = __atomic_load_n(&entry->data, __ATOMIC_RELAXED);
+    //keep deeper results, unless they're left over from an old search,
+    //or only bound what the new exact value is for the same position
+    int age = (data >> INFO_SHIFT) & ~BOUND_MASK;
+    int wasBound = (data >> INFO_SHIFT) & BOUND_MASK;
+    int exactNow = (check ^ data) == key && bound == BOUND_EXACT &&
+                   wasBound != BOUND_EXACT;
+    if (depth < (uint8_t)(data >> DEPTH_SHIFT) && age == table->age && !exactNow){
+        return;
+    }
+    data = packData(depth, value, bound, move, table->age);
+    __atomic_store_n(&entry->data, data, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->check, key ^ data, __ATOMIC_RELAXED);
+}
+
+// everything stored about a position in one word
+static uint64_t packData(int depth, int value, int bound, LocationID move, int age)
+{
+    if (depth > MAX_DEPTH) depth = MAX_DEPTH;
+    return (uint64_t)(uint32_t)value << VALUE_SHIFT |
+           (uint64_t)(uint16_t)move << MOVE_SHIFT |
+           (uint64_t)depth << DEPTH_SHIFT |
+           (uint64_t)(age | bound) << INFO_SHIFT;
+}
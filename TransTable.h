@@ -0,0 +1,53 @@
+// TransTable.h ... a transposition table of searched positions
+//
+// Positions are looked up by their Zobrist hash (GameState.h). The table
+// is a fixed power-of-two number of entries allocated up front; each
+// hash has one slot, and a new result only replaces the one there if it
+// is from at least as deep a search, or the one there is from an
+// earlier search (see ttNewSearch()). That goes for the same position
+// too, except that an exact value replaces a bound on it from any depth.
+//
+// Any number of threads can probe and store at once without locking:
+// an entry half written by one thread while another writes or reads it
+// is never returned, just missed. ttClear() and ttNewSearch() are for
+// between searches, when no other thread is using the table.
+
+#ifndef TRANS_TABLE_H
+#define TRANS_TABLE_H
+
+#include <stdint.h>
+#include "Places.h"
+
+// how a stored value relates to the real value of the position
+#define BOUND_EXACT   0
+#define BOUND_LOWER   1   // the real value is at least this
+#define BOUND_UPPER   2   // the real value is at most this
+
+typedef struct transTable *TransTable;
+
+// a table of 2^log2Entries entries, all empty
+
+TransTable newTransTable(int log2Entries);
+void disposeTransTable(TransTable toBeDeleted);
+
+// empties the table
+
+void ttClear(TransTable table);
+
+// starts a new search: everything stored so far can be replaced, even
+// by shallower results, but is still found until it is
+
+void ttNewSearch(TransTable table);
+
+// looks the position up; if it is there, fills in the depth, value,
+// bound and move stored for it and returns TRUE
+
+int ttProbe(TransTable table, uint64_t key, int *depth, int *value,
+            int *bound, LocationID *move);
+
+// stores what a search of depth plies found for the position
+
+void ttStore(TransTable table, uint64_t key, int depth, int value,
+             int bound, LocationID move);
+
+#endif
@@ -0,0 +1,96 @@
+// benchDracView.c ... benchmark the DracView ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "DracView.h"
+#include "Bench.h"
+
+#define NUM_GAMES 6
+
+static int gameRounds[NUM_GAMES] = {0, 10, 50, 100, 150, BENCH_MAX_ROUNDS};
+static char games[NUM_GAMES][BENCH_GAME_LENGTH+1];
+
+static void opNewDracView(void *arg, int i)
+{
+    DracView dv = newDracView(arg, NULL);
+    benchSink += giveMeTheScore(dv);
+    disposeDracView(dv);
+}
+
+static void opGiveMeTheTrail(void *arg, int i)
+{
+    LocationID trail[TRAIL_SIZE];
+    giveMeTheTrail(arg, i % NUM_PLAYERS, trail);
+    benchSink += trail[0];
+}
+
+static void opWhereCanIgo(void *arg, int i)
+{
+    int numLocations;
+    LocationID *locations = whereCanIgo(arg, &numLocations, TRUE, TRUE);
+    benchSink += numLocations;
+    free(locations);
+}
+
+static void opWhereCanIgoInto(void *arg, int i)
+{
+    LocationID locations[NUM_MAP_LOCATIONS];
+    benchSink += whereCanIgoInto(arg, locations, TRUE, TRUE);
+}
+
+static void opWhatsThere(void *arg, int i)
+{
+    int numTraps, numVamps;
+    whatsThere(arg, i % NUM_MAP_LOCATIONS, &numTraps, &numVamps);
+    benchSink += numTraps + numVamps;
+}
+
+static void opHowHiddenAfter(void *arg, int i)
+{
+    benchSink += howHiddenAfter(arg, i & 1 ? CITY_UNKNOWN : HIDE);
+}
+
+static void opHowHiddenAt(void *arg, int i)
+{
+    LocationID locations[NUM_MAP_LOCATIONS];
+    int hidden[NUM_MAP_LOCATIONS];
+    int numLocations = whereCanIgoInto(arg, locations, TRUE, TRUE);
+    howHiddenAt(arg, locations, numLocations, hidden);
+    benchSink += hidden[0];
+}
+
+// Dracula sees the game just before his move, after Mina Harker's
+static void dropDraculasMove(char *plays)
+{
+    int length = strlen(plays);
+    if (length >= PLAY_LENGTH) {
+        plays[length - PLAY_LENGTH] = '\0';
+    }
+}
+
+int main()
+{
+    int g;
+    char name[64];
+    for (g = 0; g < NUM_GAMES; g++) {
+        makeBenchGame(games[g], gameRounds[g], g + 1);
+        dropDraculasMove(games[g]);
+    }
+
+    benchHeader("DracView");
+    for (g = 0; g < NUM_GAMES; g++) {
+        sprintf(name, "newDracView/%d rounds", gameRounds[g]);
+        runBench(name, opNewDracView, games[g]);
+    }
+
+    DracView dv = newDracView(games[NUM_GAMES-1], NULL);
+    runBench("giveMeTheTrail", opGiveMeTheTrail, dv);
+    runBench("whereCanIgo", opWhereCanIgo, dv);
+    runBench("whereCanIgoInto", opWhereCanIgoInto, dv);
+    runBench("whatsThere", opWhatsThere, dv);
+    runBench("howHiddenAfter", opHowHiddenAfter, dv);
+    runBench("howHiddenAt", opHowHiddenAt, dv);
+    disposeDracView(dv);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+// benchGameView.c ... benchmark the GameView ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "GameView.h"
+#include "TransTable.h"
+#include "Bench.h"
+
+#define NUM_GAMES 6
+
+static int gameRounds[NUM_GAMES] = {0, 10, 50, 100, 150, BENCH_MAX_ROUNDS};
+static char games[NUM_GAMES][BENCH_GAME_LENGTH+1];
+
+static void opNewGameView(void *arg, int i)
+{
+    GameView gv = newGameView(arg, NULL);
+    benchSink += getScore(gv);
+    disposeGameView(gv);
+}
+
+static void opGetHistory(void *arg, int i)
+{
+    LocationID trail[TRAIL_SIZE];
+    getHistory(arg, i % NUM_PLAYERS, trail);
+    benchSink += trail[0];
+}
+
+static void opConnectedLocations(void *arg, int i)
+{
+    int numLocations;
+    LocationID *locations = connectedLocations(arg, &numLocations,
+                            i % NUM_MAP_LOCATIONS, i % NUM_PLAYERS, i,
+                            TRUE, TRUE, TRUE);
+    benchSink += numLocations;
+    free(locations);
+}
+
+static void opConnectedLocationsInto(void *arg, int i)
+{
+    LocationID locations[NUM_MAP_LOCATIONS];
+    benchSink += connectedLocationsInto(arg, locations,
+                 i % NUM_MAP_LOCATIONS, i % NUM_PLAYERS, i, TRUE, TRUE, TRUE);
+}
+
+static void opApplyUndoMove(void *arg, int i)
+{
+    GameState *state = arg;
+    LocationID moves[MAX_MOVES];
+    int numMoves = legalMoves(state, moves);
+    Undo undo;
+    applyMove(state, moves[i % numMoves], &undo);
+    benchSink += state->score;
+    undoMove(state, &undo);
+}
+
+static void opLegalMoves(void *arg, int i)
+{
+    LocationID moves[MAX_MOVES];
+    benchSink += legalMoves(arg, moves);
+}
+
+static void opTransTable(void *arg, int i)
+{
+    int depth, value, bound;
+    LocationID move;
+    // spread the keys over a table much bigger than the cache
+    uint64_t key = (uint64_t)i * 0x9E3779B97F4A7C15ULL;
+    ttStore(arg, key, i & 15, i, BOUND_EXACT, i % NUM_MAP_LOCATIONS);
+    benchSink += ttProbe(arg, key ^ 0x5555, &depth, &value, &bound, &move);
+}
+
+int main()
+{
+    int g;
+    char name[64];
+    for (g = 0; g < NUM_GAMES; g++) {
+        makeBenchGame(games[g], gameRounds[g], g + 1);
+    }
+
+    benchHeader("GameView");
+    for (g = 0; g < NUM_GAMES; g++) {
+        sprintf(name, "newGameView/%d rounds", gameRounds[g]);
+        runBench(name, opNewGameView, games[g]);
+    }
+
+    GameView gv = newGameView(games[NUM_GAMES-1], NULL);
+    runBench("getHistory", opGetHistory, gv);
+    runBench("connectedLocations", opConnectedLocations, gv);
+    runBench("connectedLocationsInto", opConnectedLocationsInto, gv);
+
+    // a hunter's move, then Dracula's
+    GameState state;
+    getGameState(gv, &state);
+    runBench("legalMoves (hunter)", opLegalMoves, &state);
+    runBench("apply+undoMove (hunter)", opApplyUndoMove, &state);
+    Undo undo[NUM_HUNTERS];
+    int h;
+    for (h = 0; h < NUM_HUNTERS; h++) {
+        applyMove(&state, state.location[h], &undo[h]);
+    }
+    runBench("legalMoves (Dracula)", opLegalMoves, &state);
+    runBench("apply+undoMove (Dracula)", opApplyUndoMove, &state);
+
+    TransTable table = newTransTable(22);
+    ttClear(table);   // touch every page now, not while timing
+    runBench("ttStore+ttProbe (64MB table)", opTransTable, table);
+    disposeTransTable(table);
+    disposeGameView(gv);
+    return EXIT_SUCCESS;
+}
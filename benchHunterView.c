@@ -0,0 +1,116 @@
+// benchHunterView.c ... benchmark the HunterView ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "HunterView.h"
+#include "Trails.h"
+#include "Bench.h"
+
+#define NUM_GAMES 6
+#define BENCH_MAX_TRAILS 100000
+
+static int gameRounds[NUM_GAMES] = {0, 10, 50, 100, 150, BENCH_MAX_ROUNDS};
+static char games[NUM_GAMES][BENCH_GAME_LENGTH+1];
+
+static void opNewHunterView(void *arg, int i)
+{
+    HunterView hv = newHunterView(arg, NULL);
+    benchSink += giveMeTheScore(hv);
+    disposeHunterView(hv);
+}
+
+static void opGiveMeTheTrail(void *arg, int i)
+{
+    LocationID trail[TRAIL_SIZE];
+    giveMeTheTrail(arg, i % NUM_PLAYERS, trail);
+    benchSink += trail[0];
+}
+
+static void opWhereCanIgo(void *arg, int i)
+{
+    int numLocations;
+    LocationID *locations = whereCanIgo(arg, &numLocations, TRUE, TRUE, TRUE);
+    benchSink += numLocations;
+    free(locations);
+}
+
+static void opWhereCanIgoInto(void *arg, int i)
+{
+    LocationID locations[NUM_MAP_LOCATIONS];
+    benchSink += whereCanIgoInto(arg, locations, TRUE, TRUE, TRUE);
+}
+
+static void opWhereCanTheyGo(void *arg, int i)
+{
+    int numLocations;
+    LocationID *locations = whereCanTheyGo(arg, &numLocations,
+                            i % PLAYER_DRACULA, TRUE, TRUE, TRUE);
+    benchSink += numLocations;
+    free(locations);
+}
+
+static void opBeliefDraculaMove(void *arg, int i)
+{
+    Belief belief;
+    giveMeTheBelief(arg, &belief);
+    beliefDraculaMove(&belief, i % 2 ? CITY_UNKNOWN : SEA_UNKNOWN);
+    benchSink += setSize(beliefWhere(&belief));
+}
+
+static void opHeatDraculaMove(void *arg, int i)
+{
+    Heatmap heat = *giveMeTheHeatmap(arg);
+    heatDraculaMove(&heat, i % 2 ? CITY_UNKNOWN : SEA_UNKNOWN, NULL, setAll());
+    benchSink += heatWhere(&heat)[i % NUM_MAP_LOCATIONS] > 0;
+}
+
+static void opHeatSample(void *arg, int i)
+{
+    static uint64_t seed = 88172645463325252ULL;
+    benchSink += heatSample(giveMeTheHeatmap(arg), &seed);
+}
+
+static void opParticleGuess(void *arg, int i)
+{
+    static uint64_t seed = 88172645463325252ULL;
+    GameState state;
+    giveMeTheState(arg, &state);
+    particleGuess(giveMeTheParticles(arg), &state, &seed);
+    benchSink += state.hash;
+}
+
+static void opCountTrails(void *arg, int i)
+{
+    Belief belief;
+    giveMeTheBelief(arg, &belief);
+    benchSink += countTrails(&belief, BENCH_MAX_TRAILS);
+}
+
+int main()
+{
+    int g;
+    char name[64];
+    for (g = 0; g < NUM_GAMES; g++) {
+        makeBenchGame(games[g], gameRounds[g], g + 1);
+        hideDracula(games[g]);
+    }
+
+    benchHeader("HunterView");
+    for (g = 0; g < NUM_GAMES; g++) {
+        sprintf(name, "newHunterView/%d rounds", gameRounds[g]);
+        runBench(name, opNewHunterView, games[g]);
+    }
+
+    HunterView hv = newHunterView(games[NUM_GAMES-1], NULL);
+    runBench("giveMeTheTrail", opGiveMeTheTrail, hv);
+    runBench("whereCanIgo", opWhereCanIgo, hv);
+    runBench("whereCanIgoInto", opWhereCanIgoInto, hv);
+    runBench("whereCanTheyGo", opWhereCanTheyGo, hv);
+    runBench("beliefDraculaMove", opBeliefDraculaMove, hv);
+    runBench("heatDraculaMove", opHeatDraculaMove, hv);
+    runBench("heatSample", opHeatSample, hv);
+    runBench("particleGuess", opParticleGuess, hv);
+    runBench("countTrails", opCountTrails, hv);
+    disposeHunterView(hv);
+    return EXIT_SUCCESS;
+}
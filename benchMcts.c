@@ -0,0 +1,62 @@
+// benchMcts.c ... how the hunters' search scales with threads
+//
+//   ./benchMcts [maxThreads]
+//
+// Searches the same position for a fixed time with pools of 1, 2, 4, ...
+// threads and prints the simulations per second; the total should grow
+// with the threads, as they share the tree without locking it.
+// maxThreads defaults to the number of cores.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "Globals.h"
+#include "Game.h"
+#include "HunterView.h"
+#include "ThreadPool.h"
+#include "Mcts.h"
+#include "Bench.h"
+
+#define BENCH_ROUNDS   50
+#define SEARCH_NODES   (1 << 20)
+#define SEARCH_MSECS   500
+
+static char plays[BENCH_GAME_LENGTH+1];
+
+// the search registers its moves here
+void registerBestPlay(char *play, PlayerMessage message)
+{
+}
+
+int main(int argc, char *argv[])
+{
+    int maxThreads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (maxThreads < 1) maxThreads = 1;
+
+    makeBenchGame(plays, BENCH_ROUNDS, 1);
+    hideDracula(plays);
+    PlayerMessage messages[BENCH_ROUNDS*NUM_PLAYERS];
+    HunterView hv = newHunterView(plays, messages);
+    Mcts mcts = newMcts(SEARCH_NODES, 1);
+
+    printf("\nMcts, %dms searches of a round %d position\n", SEARCH_MSECS, BENCH_ROUNDS);
+    printf("%-10s %14s %14s %10s %10s\n", "threads", "sims/s", "per thread", "speedup", "nodes");
+    double single = 0;
+    int n;
+    // 1, 2, 4, ... threads, and finally maxThreads
+    for (n = 1; ; n = n*2 < maxThreads ? n*2 : maxThreads) {
+        ThreadPool pool = newThreadPool(n);
+        mctsSetPool(mcts, pool);
+        mctsHunterMove(mcts, hv, SEARCH_MSECS);
+        double rate = mctsSimulations(mcts) / (SEARCH_MSECS / 1e3);
+        if (n == 1) single = rate;
+        printf("%-10d %14.0f %14.0f %10.2f %10d\n", n, rate, rate / n, rate / single,
+               mctsNodes(mcts));
+        mctsSetPool(mcts, NULL);
+        disposeThreadPool(pool);
+        if (n == maxThreads) break;
+    }
+    disposeMcts(mcts);
+    disposeHunterView(hv);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+// benchRollout.c ... benchmark the random playouts
+//
+// Playouts start from a mid-game position with Dracula's trail known,
+// as they do in the hunters' search once it has guessed the trail.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "GameView.h"
+#include "GameState.h"
+#include "Rollout.h"
+#include "Bench.h"
+
+#define BENCH_ROUNDS     50
+#define ROLLOUT_MOVES    50   // as long as the hunters' search plays
+
+static char game[BENCH_GAME_LENGTH+1];
+static GameState start;
+static uint64_t seed = 1;
+
+static void opRandomMove(void *arg, int i)
+{
+    benchSink += randomMove(arg, &seed, FALSE);
+}
+
+// a rollout as the search does them, through legalMoves()
+static void opListedPlayout(void *arg, int i)
+{
+    GameState state = start;
+    int n;
+    for (n = 0; n < ROLLOUT_MOVES && !isGameOver(&state); n++){
+        LocationID moves[MAX_MOVES];
+        int numMoves = legalMoves(&state, moves);
+        Undo undo;
+        applyMove(&state, moves[(i + n*7) % numMoves], &undo);
+    }
+    benchSink += state.score;
+}
+
+static void opPlayout(void *arg, int i)
+{
+    GameState state = start;
+    benchSink += playout(&state, &seed, (long)arg, FALSE);
+}
+
+static void opHeuristicPlayout(void *arg, int i)
+{
+    GameState state = start;
+    benchSink += playout(&state, &seed, (long)arg, TRUE);
+}
+
+int main()
+{
+    makeBenchGame(game, BENCH_ROUNDS, 1);
+    GameView gv = newGameView(game, NULL);
+    getGameState(gv, &start);
+    disposeGameView(gv);
+
+    benchHeader("Rollout");
+    runBench("randomMove (hunter)", opRandomMove, &start);
+    GameState dracula = start;
+    Undo undo[NUM_HUNTERS];
+    int h;
+    for (h = 0; h < NUM_HUNTERS; h++) {
+        applyMove(&dracula, dracula.location[h], &undo[h]);
+    }
+    runBench("randomMove (Dracula)", opRandomMove, &dracula);
+    runBench("legalMoves+applyMove x50", opListedPlayout, NULL);
+    runBench("playout x50", opPlayout, (void *)(long)ROLLOUT_MOVES);
+    runBench("playout x50 (heuristic)", opHeuristicPlayout, (void *)(long)ROLLOUT_MOVES);
+    runBench("playout to the end", opPlayout, (void *)(long)PLAYOUT_TO_END);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+// benchTransTable.c ... how a shared TransTable scales with threads
+//
+//   ./benchTransTable [maxThreads]
+//
+// Each thread stores and probes random positions in one shared table
+// for a fixed time; the total rate should grow with the threads, as
+// nothing is locked. maxThreads defaults to the number of cores.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "TransTable.h"
+#include "Bench.h"
+
+#define LOG2_ENTRIES   24              // 256MB, far bigger than any cache
+#define RUN_NSECS      500000000L
+
+static TransTable table;
+static volatile int running;
+
+static long nowNsecs(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec*1000000000L + t.tv_nsec;
+}
+
+// stores then probes random positions until told to stop, returns how many
+static void *worker(void *arg)
+{
+    uint64_t seed = (uintptr_t)arg * 0x9E3779B97F4A7C15ULL;
+    long ops = 0, found = 0;
+    int depth, value, bound;
+    LocationID move;
+    while (running) {
+        int i;
+        for (i = 0; i < 1024; i++) {
+            seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+            ttStore(table, seed, i & 15, i, BOUND_EXACT, i % NUM_MAP_LOCATIONS);
+            found += ttProbe(table, seed ^ (seed >> 29), &depth, &value, &bound, &move);
+        }
+        ops += 1024;
+    }
+    __atomic_fetch_add(&benchSink, found, __ATOMIC_RELAXED);
+    return (void *)ops;
+}
+
+int main(int argc, char *argv[])
+{
+    int maxThreads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (maxThreads < 1) maxThreads = 1;
+    pthread_t threads[maxThreads];
+
+    table = newTransTable(LOG2_ENTRIES);
+    ttClear(table);   // touch every page now, not while timing
+
+    printf("\nTransTable, store+probe pairs in a shared %dMB table\n",
+           (int)((16L << LOG2_ENTRIES) >> 20));
+    printf("%-10s %14s %14s %10s\n", "threads", "Mops/s", "per thread", "speedup");
+    double single = 0;
+    int n, t;
+    // 1, 2, 4, ... threads, and finally maxThreads
+    for (n = 1; ; n = n*2 < maxThreads ? n*2 : maxThreads) {
+        running = TRUE;
+        long start = nowNsecs();
+        for (t = 0; t < n; t++) {
+            pthread_create(&threads[t], NULL, worker, (void *)(uintptr_t)(t + 1));
+        }
+        struct timespec run = {RUN_NSECS / 1000000000L, RUN_NSECS % 1000000000L};
+        nanosleep(&run, NULL);
+        running = FALSE;
+        long ops = 0;
+        for (t = 0; t < n; t++) {
+            void *done;
+            pthread_join(threads[t], &done);
+            ops += (long)done;
+        }
+        double rate = ops / ((nowNsecs() - start) / 1e3);
+        if (n == 1) single = rate;
+        printf("%-10d %14.1f %14.1f %10.2f\n", n, rate, rate / n, rate / single);
+        if (n == maxThreads) break;
+    }
+    disposeTransTable(table);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+// genGames.c ... write random legal games to a file, one per line
+//
+//   ./genGames [numGames] [seed] [file]
+//
+// Games are pastPlays strings as Dracula sees them (see GameGen.h),
+// streamed out as they are made, so any number of them can be written
+// in constant memory. Writes to stdout if no file is given.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "GameGen.h"
+
+#define DEFAULT_GAMES   1000
+#define DEFAULT_SEED    1
+
+static char game[MAX_GAME_LENGTH+1];
+
+int main(int argc, char *argv[])
+{
+    long numGames = argc > 1 ? atol(argv[1]) : DEFAULT_GAMES;
+    unsigned int seed = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : DEFAULT_SEED;
+    FILE *out = stdout;
+    if (argc > 3){
+        out = fopen(argv[3], "w");
+        if (out == NULL){
+            perror(argv[3]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    GameGen gen = newGameGen(seed);
+    long g, totalPlays = 0;
+    for (g = 0; g < numGames; g++){
+        totalPlays += generateGame(gen, game, MAX_GAME_ROUNDS);
+        fputs(game, out);
+        fputc('\n', out);
+    }
+    disposeGameGen(gen);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec)/1e9;
+    if (out != stdout && fclose(out) != 0){
+        perror(argv[3]);
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, "%ld games, %ld plays in %.2fs (%.0f games/s)\n",
+            numGames, totalPlays, secs, secs > 0 ? numGames/secs : 0);
+    return EXIT_SUCCESS;
+}
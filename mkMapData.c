@@ -0,0 +1,371 @@
+// mkMapData.c ... generates MapData.h, the constant map of Europe
+// Usage: ./mkMapData > MapData.h
+//
+// Map.c includes MapData.h as the initialiser of its one struct MapRep,
+// so the graph is laid out at compile time and newMap() does no work.
+// Edit the links here (not in MapData.h) to change the map.
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "Map.h"
+#include "Places.h"
+
+static Edge links[] = {
+   //### ROAD Connections ###
+
+   {ALICANTE, GRANADA, ROAD},
+   {ALICANTE, MADRID, ROAD},
+   {ALICANTE, SARAGOSSA, ROAD},
+   {AMSTERDAM, BRUSSELS, ROAD},
+   {AMSTERDAM, COLOGNE, ROAD},
+   {ATHENS, VALONA, ROAD},
+   {BARCELONA, SARAGOSSA, ROAD},
+   {BARCELONA, TOULOUSE, ROAD},
+   {BARI, NAPLES, ROAD},
+   {BARI, ROME, ROAD},
+   {BELGRADE, BUCHAREST, ROAD},
+   {BELGRADE, KLAUSENBURG, ROAD},
+   {BELGRADE, SARAJEVO, ROAD},
+   {BELGRADE, SOFIA, ROAD},
+   {BELGRADE, ST_JOSEPH_AND_ST_MARYS, ROAD},
+   {BELGRADE, SZEGED, ROAD},
+   {BERLIN, HAMBURG, ROAD},
+   {BERLIN, LEIPZIG, ROAD},
+   {BERLIN, PRAGUE, ROAD},
+   {BORDEAUX, CLERMONT_FERRAND, ROAD},
+   {BORDEAUX, NANTES, ROAD},
+   {BORDEAUX, SARAGOSSA, ROAD},
+   {BORDEAUX, TOULOUSE, ROAD},
+   {BRUSSELS, COLOGNE, ROAD},
+   {BRUSSELS, LE_HAVRE, ROAD},
+   {BRUSSELS, PARIS, ROAD},
+   {BRUSSELS, STRASBOURG, ROAD},
+   {BUCHAREST, CONSTANTA, ROAD},
+   {BUCHAREST, GALATZ, ROAD},
+   {BUCHAREST, KLAUSENBURG, ROAD},
+   {BUCHAREST, SOFIA, ROAD},
+   {BUDAPEST, KLAUSENBURG, ROAD},
+   {BUDAPEST, SZEGED, ROAD},
+   {BUDAPEST, VIENNA, ROAD},
+   {BUDAPEST, ZAGREB, ROAD},
+   {CADIZ, GRANADA, ROAD},
+   {CADIZ, LISBON, ROAD},
+   {CADIZ, MADRID, ROAD},
+   {CASTLE_DRACULA, GALATZ, ROAD},
+   {CASTLE_DRACULA, KLAUSENBURG, ROAD},
+   {CLERMONT_FERRAND, GENEVA, ROAD},
+   {CLERMONT_FERRAND, MARSEILLES, ROAD},
+   {CLERMONT_FERRAND, NANTES, ROAD},
+   {CLERMONT_FERRAND, PARIS, ROAD},
+   {CLERMONT_FERRAND, TOULOUSE, ROAD},
+   {COLOGNE, FRANKFURT, ROAD},
+   {COLOGNE, HAMBURG, ROAD},
+   {COLOGNE, LEIPZIG, ROAD},
+   {COLOGNE, STRASBOURG, ROAD},
+   {CONSTANTA, GALATZ, ROAD},
+   {CONSTANTA, VARNA, ROAD},
+   {DUBLIN, GALWAY, ROAD},
+   {EDINBURGH, MANCHESTER, ROAD},
+   {FLORENCE, GENOA, ROAD},
+   {FLORENCE, ROME, ROAD},
+   {FLORENCE, VENICE, ROAD},
+   {FRANKFURT, LEIPZIG, ROAD},
+   {FRANKFURT, NUREMBURG, ROAD},
+   {FRANKFURT, STRASBOURG, ROAD},
+   {GALATZ, KLAUSENBURG, ROAD},
+   {GENEVA, MARSEILLES, ROAD},
+   {GENEVA, PARIS, ROAD},
+   {GENEVA, STRASBOURG, ROAD},
+   {GENEVA, ZURICH, ROAD},
+   {GENOA, MARSEILLES, ROAD},
+   {GENOA, MILAN, ROAD},
+   {GENOA, VENICE, ROAD},
+   {GRANADA, MADRID, ROAD},
+   {HAMBURG, LEIPZIG, ROAD},
+   {KLAUSENBURG, SZEGED, ROAD},
+   {LEIPZIG, NUREMBURG, ROAD},
+   {LE_HAVRE, NANTES, ROAD},
+   {LE_HAVRE, PARIS, ROAD},
+   {LISBON, MADRID, ROAD},
+   {LISBON, SANTANDER, ROAD},
+   {LIVERPOOL, MANCHESTER, ROAD},
+   {LIVERPOOL, SWANSEA, ROAD},
+   {LONDON, MANCHESTER, ROAD},
+   {LONDON, PLYMOUTH, ROAD},
+   {LONDON, SWANSEA, ROAD},
+   {MADRID, SANTANDER, ROAD},
+   {MADRID, SARAGOSSA, ROAD},
+   {MARSEILLES, MILAN, ROAD},
+   {MARSEILLES, TOULOUSE, ROAD},
+   {MARSEILLES, ZURICH, ROAD},
+   {MILAN, MUNICH, ROAD},
+   {MILAN, VENICE, ROAD},
+   {MILAN, ZURICH, ROAD},
+   {MUNICH, NUREMBURG, ROAD},
+   {MUNICH, STRASBOURG, ROAD},
+   {MUNICH, VENICE, ROAD},
+   {MUNICH, VIENNA, ROAD},
+   {MUNICH, ZAGREB, ROAD},
+   {MUNICH, ZURICH, ROAD},
+   {NANTES, PARIS, ROAD},
+   {NAPLES, ROME, ROAD},
+   {NUREMBURG, PRAGUE, ROAD},
+   {NUREMBURG, STRASBOURG, ROAD},
+   {PARIS, STRASBOURG, ROAD},
+   {PRAGUE, VIENNA, ROAD},
+   {SALONICA, SOFIA, ROAD},
+   {SALONICA, VALONA, ROAD},
+   {SANTANDER, SARAGOSSA, ROAD},
+   {SARAGOSSA, TOULOUSE, ROAD},
+   {SARAJEVO, SOFIA, ROAD},
+   {SARAJEVO, ST_JOSEPH_AND_ST_MARYS, ROAD},
+   {SARAJEVO, VALONA, ROAD},
+   {SARAJEVO, ZAGREB, ROAD},
+   {SOFIA, VALONA, ROAD},
+   {SOFIA, VARNA, ROAD},
+   {STRASBOURG, ZURICH, ROAD},
+   {ST_JOSEPH_AND_ST_MARYS, SZEGED, ROAD},
+   {ST_JOSEPH_AND_ST_MARYS, ZAGREB, ROAD},
+   {SZEGED, ZAGREB, ROAD},
+   {VIENNA, ZAGREB, ROAD},
+
+   //### RAIL Connections ###
+
+   {ALICANTE, BARCELONA, RAIL},
+   {ALICANTE, MADRID, RAIL},
+   {BARCELONA, SARAGOSSA, RAIL},
+   {BARI, NAPLES, RAIL},
+   {BELGRADE, SOFIA, RAIL},
+   {BELGRADE, SZEGED, RAIL},
+   {BERLIN, HAMBURG, RAIL},
+   {BERLIN, LEIPZIG, RAIL},
+   {BERLIN, PRAGUE, RAIL},
+   {BORDEAUX, PARIS, RAIL},
+   {BORDEAUX, SARAGOSSA, RAIL},
+   {BRUSSELS, COLOGNE, RAIL},
+   {BRUSSELS, PARIS, RAIL},
+   {BUCHAREST, CONSTANTA, RAIL},
+   {BUCHAREST, GALATZ, RAIL},
+   {BUCHAREST, SZEGED, RAIL},
+   {BUDAPEST, SZEGED, RAIL},
+   {BUDAPEST, VIENNA, RAIL},
+   {COLOGNE, FRANKFURT, RAIL},
+   {EDINBURGH, MANCHESTER, RAIL},
+   {FLORENCE, MILAN, RAIL},
+   {FLORENCE, ROME, RAIL},
+   {FRANKFURT, LEIPZIG, RAIL},
+   {FRANKFURT, STRASBOURG, RAIL},
+   {GENEVA, MILAN, RAIL},
+   {GENOA, MILAN, RAIL},
+   {LEIPZIG, NUREMBURG, RAIL},
+   {LE_HAVRE, PARIS, RAIL},
+   {LISBON, MADRID, RAIL},
+   {LIVERPOOL, MANCHESTER, RAIL},
+   {LONDON, MANCHESTER, RAIL},
+   {LONDON, SWANSEA, RAIL},
+   {MADRID, SANTANDER, RAIL},
+   {MADRID, SARAGOSSA, RAIL},
+   {MARSEILLES, PARIS, RAIL},
+   {MILAN, ZURICH, RAIL},
+   {MUNICH, NUREMBURG, RAIL},
+   {NAPLES, ROME, RAIL},
+   {PRAGUE, VIENNA, RAIL},
+   {SALONICA, SOFIA, RAIL},
+   {SOFIA, VARNA, RAIL},
+   {STRASBOURG, ZURICH, RAIL},
+   {VENICE, VIENNA, RAIL},
+
+   //### BOAT Connections ###
+
+   {ADRIATIC_SEA, BARI, BOAT},
+   {ADRIATIC_SEA, IONIAN_SEA, BOAT},
+   {ADRIATIC_SEA, VENICE, BOAT},
+   {ALICANTE, MEDITERRANEAN_SEA, BOAT},
+   {AMSTERDAM, NORTH_SEA, BOAT},
+   {ATHENS, IONIAN_SEA, BOAT},
+   {ATLANTIC_OCEAN, BAY_OF_BISCAY, BOAT},
+   {ATLANTIC_OCEAN, CADIZ, BOAT},
+   {ATLANTIC_OCEAN, ENGLISH_CHANNEL, BOAT},
+   {ATLANTIC_OCEAN, GALWAY, BOAT},
+   {ATLANTIC_OCEAN, IRISH_SEA, BOAT},
+   {ATLANTIC_OCEAN, LISBON, BOAT},
+   {ATLANTIC_OCEAN, MEDITERRANEAN_SEA, BOAT},
+   {ATLANTIC_OCEAN, NORTH_SEA, BOAT},
+   {BARCELONA, MEDITERRANEAN_SEA, BOAT},
+   {BAY_OF_BISCAY, BORDEAUX, BOAT},
+   {BAY_OF_BISCAY, NANTES, BOAT},
+   {BAY_OF_BISCAY, SANTANDER, BOAT},
+   {BLACK_SEA, CONSTANTA, BOAT},
+   {BLACK_SEA, IONIAN_SEA, BOAT},
+   {BLACK_SEA, VARNA, BOAT},
+   {CAGLIARI, MEDITERRANEAN_SEA, BOAT},
+   {CAGLIARI, TYRRHENIAN_SEA, BOAT},
+   {DUBLIN, IRISH_SEA, BOAT},
+   {EDINBURGH, NORTH_SEA, BOAT},
+   {ENGLISH_CHANNEL, LE_HAVRE, BOAT},
+   {ENGLISH_CHANNEL, LONDON, BOAT},
+   {ENGLISH_CHANNEL, NORTH_SEA, BOAT},
+   {ENGLISH_CHANNEL, PLYMOUTH, BOAT},
+   {GENOA, TYRRHENIAN_SEA, BOAT},
+   {HAMBURG, NORTH_SEA, BOAT},
+   {IONIAN_SEA, SALONICA, BOAT},
+   {IONIAN_SEA, TYRRHENIAN_SEA, BOAT},
+   {IONIAN_SEA, VALONA, BOAT},
+   {IRISH_SEA, LIVERPOOL, BOAT},
+   {IRISH_SEA, SWANSEA, BOAT},
+   {MARSEILLES, MEDITERRANEAN_SEA, BOAT},
+   {MEDITERRANEAN_SEA, TYRRHENIAN_SEA, BOAT},
+   {NAPLES, TYRRHENIAN_SEA, BOAT},
+   {ROME, TYRRHENIAN_SEA, BOAT},
+};
+
+#define NUM_LINKS ((int)(sizeof(links)/sizeof(links[0])))
+
+static int first[NUM_MAP_LOCATIONS][MAX_TRANSPORT+2];
+static LocationID adj[2*NUM_LINKS];
+static int nE[ANY+1];
+static LocationSet conn[NUM_MAP_LOCATIONS][ANY+1];
+static LocationSet rail[NUM_MAP_LOCATIONS][MAX_RAIL_HOPS+1];
+
+static void checkLinks(void);
+static void buildAdjacency(void);
+static void buildRailReach(void);
+static void printSet(LocationSet s);
+static void printData(void);
+
+int main(void)
+{
+   checkLinks();
+   buildAdjacency();
+   buildRailReach();
+   printData();
+   return EXIT_SUCCESS;
+}
+
+// every link must be between real places, and appear only once
+static void checkLinks(void)
+{
+   int i, j;
+   for (i = 0; i < NUM_LINKS; i++) {
+      Edge *e = &links[i];
+      assert(validPlace(e->start) && validPlace(e->end));
+      assert(e->type >= MIN_TRANSPORT && e->type <= MAX_TRANSPORT);
+      for (j = 0; j < i; j++) {
+         Edge *f = &links[j];
+         if (e->type == f->type &&
+             ((e->start == f->start && e->end == f->end) ||
+              (e->start == f->end && e->end == f->start))) {
+            fprintf(stderr, "duplicate link %s - %s\n",
+                    idToName(e->start), idToName(e->end));
+            exit(EXIT_FAILURE);
+         }
+      }
+   }
+}
+
+// Lay the links out in adj[], grouped by location then by transport type
+static void buildAdjacency(void)
+{
+   int count[NUM_MAP_LOCATIONS][MAX_TRANSPORT+2] = {{0}};
+   int i, t, next = 0;
+   for (i = 0; i < NUM_LINKS; i++) {
+      count[links[i].start][links[i].type]++;
+      count[links[i].end][links[i].type]++;
+      nE[links[i].type] += 2;
+      nE[ANY] += 2;
+   }
+   for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
+      for (t = MIN_TRANSPORT; t <= MAX_TRANSPORT; t++) {
+         first[i][t] = next;
+         next += count[i][t];
+         count[i][t] = first[i][t]; // now the next free slot
+      }
+      first[i][MAX_TRANSPORT+1] = next;
+   }
+   for (i = 0; i < NUM_LINKS; i++) {
+      Edge *e = &links[i];
+      adj[count[e->start][e->type]++] = e->end;
+      adj[count[e->end][e->type]++] = e->start;
+      setAdd(&conn[e->start][e->type], e->end);
+      setAdd(&conn[e->end][e->type], e->start);
+      setAdd(&conn[e->start][ANY], e->end);
+      setAdd(&conn[e->end][ANY], e->start);
+   }
+}
+
+// rail[v][k] is every station within k stops of v (including v)
+static void buildRailReach(void)
+{
+   int i, k;
+   for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
+      rail[i][0] = setOf(i);
+      for (k = 1; k <= MAX_RAIL_HOPS; k++) {
+         LocationSet stations = rail[i][k-1];
+         LocationSet next = stations;
+         while (!setIsEmpty(stations)) {
+            LocationID v = setPopFirst(&stations);
+            next = setUnion(next, conn[v][RAIL]);
+         }
+         rail[i][k] = next;
+      }
+   }
+}
+
+static void printSet(LocationSet s)
+{
+   printf("{{ 0x%016llxULL, 0x%016llxULL }}",
+          (unsigned long long)s.bits[0], (unsigned long long)s.bits[1]);
+}
+
+static void printData(void)
+{
+   int i, t;
+   printf("// MapData.h ... generated by mkMapData, do not edit\n");
+   printf("// Initialiser for the struct MapRep in Map.c\n\n");
+   printf("   %d, // nV\n", NUM_MAP_LOCATIONS);
+   printf("   { ");
+   for (t = 0; t <= ANY; t++) printf("%d%s", nE[t], t < ANY ? ", " : "");
+   printf(" }, // nE by transport type\n");
+   printf("   { // first\n");
+   for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
+      printf("      { ");
+      for (t = 0; t <= MAX_TRANSPORT+1; t++) {
+         printf("%3d%s", t < MIN_TRANSPORT ? 0 : first[i][t],
+                t <= MAX_TRANSPORT ? ", " : "");
+      }
+      printf(" }, // %s\n", idToName(i));
+   }
+   printf("   },\n");
+   printf("   { // adj\n");
+   for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
+      int j, end = first[i][MAX_TRANSPORT+1];
+      if (first[i][MIN_TRANSPORT] == end) continue;
+      printf("     ");
+      for (j = first[i][MIN_TRANSPORT]; j < end; j++) printf(" %2d,", adj[j]);
+      printf(" // %s\n", idToName(i));
+   }
+   printf("   },\n");
+   printf("   { // conn\n");
+   for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
+      printf("      { // %s\n", idToName(i));
+      for (t = 0; t <= ANY; t++) {
+         printf("         ");
+         printSet(conn[i][t]);
+         printf(",\n");
+      }
+      printf("      },\n");
+   }
+   printf("   },\n");
+   printf("   { // rail\n");
+   for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
+      printf("      { // %s\n", idToName(i));
+      for (t = 0; t <= MAX_RAIL_HOPS; t++) {
+         printf("         ");
+         printSet(rail[i][t]);
+         printf(",\n");
+      }
+      printf("      },\n");
+   }
+   printf("   },\n");
+}
@@ -0,0 +1,128 @@
+// testAlphaBeta.c ... test Dracula's alpha-beta search
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "Globals.h"
+#include "Game.h"
+#include "DracView.h"
+#include "GameState.h"
+#include "GameView.h"
+#include "GameGen.h"
+#include "AlphaBeta.h"
+
+#define SEARCH_MSECS 200
+#define NUM_TEST_GAMES 10
+#define BONUS_DEPTH    4       // plies searched comparing bonuses
+#define BONUS          500     // added to every first move
+
+static char game[MAX_GAME_LENGTH+1];
+
+// what the search has told the game engine
+static char registered[3];
+static int numRegistered = 0;
+
+void registerBestPlay(char *play, PlayerMessage message)
+{
+    strncpy(registered, play, 2);
+    registered[2] = '\0';
+    numRegistered ++;
+}
+
+static long nowMsecs(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec*1000L + t.tv_nsec/1000000L;
+}
+
+int main()
+{
+    PlayerMessage messages[20] = {""};
+    AlphaBeta search = newAlphaBeta(16);
+
+    printf("Test a legal move is registered in time\n");
+    DracView dv = newDracView("GMN.... SPL.... HAM.... MPA.... DGE.V.. "
+                              "GLV.... SLO.... HNS.... MST.... DZUT... "
+                              "GIR.... SLO.... HAO.... MZU....", messages);
+    long start = nowMsecs();
+    LocationID move = abDraculaMove(search, dv, SEARCH_MSECS);
+    assert(nowMsecs() - start < SEARCH_MSECS + 50);
+    assert(numRegistered > 0);
+    assert(strcmp(registered, idToAbbrev(move)) == 0);
+    GameState state;
+    giveMeTheState(dv, &state);
+    LocationID moves[MAX_MOVES];
+    int i, numMoves = legalMoves(&state, moves);
+    for (i = 0; i < numMoves && moves[i] != move; i++);
+    assert(i < numMoves);
+    //Mina is in Zurich
+    assert(move != ZURICH && move != HIDE);
+    assert(abDepth(search) >= 2 && abNodes(search) > 0);
+    printf("depth %d, %ld positions\n", abDepth(search), abNodes(search));
+    disposeDracView(dv);
+    printf("passed\n");
+
+    printf("Test Dracula gets off the sea with no blood to spare\n");
+    Undo undo;
+    initGameState(&state);
+    applyMove(&state, LISBON, &undo);
+    applyMove(&state, CADIZ, &undo);
+    applyMove(&state, MADRID, &undo);
+    applyMove(&state, GRANADA, &undo);
+    applyMove(&state, NORTH_SEA, &undo);
+    applyMove(&state, LISBON, &undo);
+    applyMove(&state, CADIZ, &undo);
+    applyMove(&state, MADRID, &undo);
+    applyMove(&state, GRANADA, &undo);
+    state.draculaHealth = LIFE_LOSS_SEA;
+    state.hash = hashGameState(&state);
+    move = abSearch(search, &state, SEARCH_MSECS);
+    assert(validPlace(move) && idToType(move) != SEA);
+    assert(abbrevToID(registered) == move);
+    assert(abValue(search) > -AB_WIN + 100);
+    printf("passed\n");
+
+    printf("Test a bonus on every first move only adds to the value\n");
+    //a first move that fails low is only known to be worth at most what
+    //is returned, so a bonus added to that mustn't make it the best
+    GameGen gen = newGameGen(25);
+    int numCompared = 0, g;
+    int bonus[TELEPORT+1];
+    for (i = 0; i <= TELEPORT; i++){
+        bonus[i] = BONUS;
+    }
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        int numPlays = generateGame(gen, game, MAX_GAME_ROUNDS);
+        int cut = (numPlays/2/NUM_PLAYERS)*NUM_PLAYERS + PLAYER_DRACULA;
+        game[cut*PLAY_LENGTH - 1] = '\0';
+        GameView gv = newGameView(game, messages);
+        getGameState(gv, &state);
+        disposeGameView(gv);
+
+        AlphaBeta plain = newAlphaBeta(16);
+        abSetMaxDepth(plain, BONUS_DEPTH);
+        LocationID plainMove = abSearch(plain, &state, 100*SEARCH_MSECS);
+        AlphaBeta shifted = newAlphaBeta(16);
+        abSetMaxDepth(shifted, BONUS_DEPTH);
+        LocationID shiftedMove = abSearchBonus(shifted, &state, bonus, 100*SEARCH_MSECS);
+        //(with only one move he doesn't search at all)
+        if (abDepth(plain) == BONUS_DEPTH &&
+            abValue(plain) < AB_WIN - 100 && abValue(plain) > -AB_WIN + 100){
+            assert(abDepth(shifted) == BONUS_DEPTH);
+            assert(shiftedMove == plainMove);
+            assert(abValue(shifted) == abValue(plain) + BONUS);
+            numCompared ++;
+        }
+        disposeAlphaBeta(plain);
+        disposeAlphaBeta(shifted);
+    }
+    disposeGameGen(gen);
+    assert(numCompared > 0);
+    printf("passed\n");
+
+    disposeAlphaBeta(search);
+    return EXIT_SUCCESS;
+}
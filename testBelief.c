@@ -0,0 +1,106 @@
+// testBelief.c ... test the hunters' Belief about where Dracula is
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "GameView.h"
+#include "GameState.h"
+#include "GameGen.h"
+#include "Replay.h"
+#include "Belief.h"
+
+#define NUM_TEST_GAMES 200
+
+static char game[MAX_GAME_LENGTH+1];
+
+// plays the game a play at a time, checking every move of Dracula's
+// real trail is somewhere the hunters' belief allows
+static void checkGame(long *totalSize, long *numSizes)
+{
+    Replay replay = newReplay(game);
+    Belief belief;
+    initBelief(&belief);
+    int i;
+    while (replayNext(replay) != NULL){
+        beliefAppend(&belief, replayHidden(replay));
+        replayStep(replay);
+
+        GameState state;
+        getGameState(replayView(replay), &state);
+        for (i = 0; i < TRAIL_SIZE; i++){
+            LocationID where = trailWhere(&state, i);
+            if (validPlace(where)){
+                assert(setHas(beliefTrail(&belief, i), where));
+            } else {
+                assert(setIsEmpty(beliefTrail(&belief, i)));
+            }
+        }
+        if (validPlace(trailWhere(&state, 0))){
+            *totalSize += setSize(beliefWhere(&belief));
+            (*numSizes) ++;
+        }
+    }
+    disposeReplay(replay);
+}
+
+int main()
+{
+    Belief belief;
+
+    printf("Test Dracula is always somewhere the belief allows\n");
+    GameGen gen = newGameGen(11);
+    long totalSize = 0, numSizes = 0;
+    int g;
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        generateGame(gen, game, MAX_GAME_ROUNDS);
+        checkGame(&totalSize, &numSizes);
+    }
+    disposeGameGen(gen);
+    printf("%.1f places on average\n", (double)totalSize / numSizes);
+    assert(totalSize < numSizes * NUM_MAP_LOCATIONS / 2);
+    printf("passed\n");
+
+    printf("Test hidden moves spread out from where he was seen\n");
+    initBelief(&belief);
+    beliefAppend(&belief, "GMN.... SPL.... HAM.... MPA.... DCN.T.. "
+                          "GLV.... SLO.... HNS.... MST.... DS?....");
+    assert(setEquals(beliefWhere(&belief), setOf(BLACK_SEA)));  //the only sea
+    assert(setEquals(beliefTrail(&belief, 1), setOf(CONSTANTA)));
+    beliefAppend(&belief, "GLO.... SLO.... HNS.... MST.... DC?....");
+    assert(setEquals(beliefWhere(&belief), setOf(VARNA)));   //Constanta's on the trail
+    printf("passed\n");
+
+    printf("Test a hunter finding him pins down the trail\n");
+    initBelief(&belief);
+    beliefAppend(&belief, "GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                          "GLV.... SLO.... HNS.... MST.... DC?T... "
+                          "GLO.... SLO.... HNS.... MST.... DHI....");
+    LocationSet nearCastle = setOf(GALATZ);
+    setAdd(&nearCastle, KLAUSENBURG);
+    assert(setEquals(beliefWhere(&belief), nearCastle));
+    assert(setEquals(beliefTrail(&belief, 1), nearCastle));
+    beliefAppend(&belief, "GLO.... SLO.... HKLD...");
+    assert(setEquals(beliefWhere(&belief), setOf(KLAUSENBURG)));
+    assert(setEquals(beliefTrail(&belief, 1), setOf(KLAUSENBURG)));   //he hid there
+    printf("passed\n");
+
+    printf("Test a hunter not finding him rules out where they are\n");
+    initBelief(&belief);
+    beliefAppend(&belief, "GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                          "GLV.... SLO.... HNS.... MST.... DC?T... "
+                          "GKL....");
+    assert(setEquals(beliefWhere(&belief), setOf(GALATZ)));
+    printf("passed\n");
+
+    printf("Test a trap found shows which move left it\n");
+    initBelief(&belief);
+    beliefAppend(&belief, "GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                          "GLV.... SLO.... HNS.... MST.... DC?T... "
+                          "GLO.... SLO.... HNS.... MST.... DC?T... "
+                          "GLO.... SLO.... HNS.... MBDT...");
+    assert(setEquals(beliefWhere(&belief), setOf(BUDAPEST)));   //only he was near
+    assert(setEquals(beliefTrail(&belief, 1), setOf(KLAUSENBURG)));
+    printf("passed\n");
+    return EXIT_SUCCESS;
+}
@@ -5,6 +5,7 @@
 #include <assert.h>
 #include <string.h>
 #include "DracView.h"
+#include "Belief.h"
 
 int main()
 {
@@ -110,6 +111,54 @@ int main()
     free(edges);
     disposeDracView(dv);
 
+    printf("Checking Dracula can hide or double back from Paris\n");
+    PlayerMessage messages8[] = {"","","","","","","","","",""};
+    dv = newDracView("GST.... SAO.... HZU.... MBB.... DGE.... "
+                     "GST.... SAO.... HZU.... MBB.... DPA.... "
+                     "GST.... SAO.... HZU.... MBB....", messages8);
+    LocationID moves[NUM_MAP_LOCATIONS];
+    size = whereCanIgoInto(dv,moves,1,0);
+    memset(seen, 0, NUM_MAP_LOCATIONS*sizeof(int));
+    for (i = 0; i < size; i++) seen[moves[i]] = 1;
+    assert(size == 7); assert(seen[PARIS]); assert(seen[GENEVA]);
+    assert(seen[BRUSSELS]); assert(seen[STRASBOURG]); assert(!seen[BORDEAUX]);
+    disposeDracView(dv);
+
+    printf("passed\n");
+
+    printf("Test for what the hunters know of where Dracula is\n");
+    PlayerMessage messages9[] = {"","","","","","","","","","","","","",""};
+    dv = newDracView("GST.... SAO.... HZU.... MBB.... DGE.... "
+                     "GST.... SAO.... HZU.... MBB.... DPA.... "
+                     "GST.... SAO.... HZU.... MBB....", messages9);
+    Belief belief;
+    initBelief(&belief);
+    beliefAppend(&belief, "GST.... SAO.... HZU.... MBB.... DC?.... "
+                          "GST.... SAO.... HZU.... MBB.... DC?.... "
+                          "GST.... SAO.... HZU.... MBB....");
+    assert(setEquals(whereDoTheyThinkIAm(dv), beliefWhere(&belief)));
+    assert(setHas(whereDoTheyThinkIAm(dv), PARIS));
+    int before = setSize(whereDoTheyThinkIAm(dv));
+    assert(howHiddenAfter(dv, HIDE) == before);
+    assert(howHiddenAfter(dv, BRUSSELS) > before);
+    dracViewAppend(dv, " DHI....", messages9);
+    assert(setSize(whereDoTheyThinkIAm(dv)) == before);
+    disposeDracView(dv);
+
+    printf("Checking a move out of Castle Dracula\n");
+    dv = newDracView("GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                     "GLV.... SLO.... HNS.... MST....", messages9);
+    assert(setEquals(whereDoTheyThinkIAm(dv), setOf(CASTLE_DRACULA)));
+    assert(howHiddenAfter(dv, GALATZ) == 2);
+    assert(howHiddenAfter(dv, HIDE) == 1);
+    assert(howHiddenAfter(dv, DOUBLE_BACK_1) == 1);
+    LocationID places[] = {GALATZ, KLAUSENBURG, CASTLE_DRACULA, PARIS};
+    int hidden[4];
+    howHiddenAt(dv, places, 4, hidden);
+    assert(hidden[0] == 2 && hidden[1] == 2);
+    assert(hidden[2] == 1 && hidden[3] == 0);
+    disposeDracView(dv);
+
     printf("passed\n");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+// testGameGen.c ... test the GameGen ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "GameView.h"
+#include "GameGen.h"
+#include "Replay.h"
+
+#define NUM_TEST_GAMES 200
+
+static char game[MAX_GAME_LENGTH+1];
+static char again[MAX_GAME_LENGTH+1];
+
+// TRUE if move is one of the moves
+static int isOneOf(LocationID move, LocationID moves[], int numMoves)
+{
+    int i;
+    for (i = 0; i < numMoves; i++){
+        if (moves[i] == move) return TRUE;
+    }
+    return FALSE;
+}
+
+// replays the game a play at a time, checking every move is legal
+static void checkGame(char *plays, int numPlays, int maxRounds)
+{
+    Replay replay = newReplay(plays);
+    GameView gv = replayView(replay);
+    char *play;
+    assert((int)strlen(plays) == (numPlays > 0 ? numPlays*PLAY_LENGTH - 1 : 0));
+    while ((play = replayNext(replay)) != NULL){
+        //the game must not go on once it's over
+        assert(getScore(gv) > 0 && getHealth(gv, PLAYER_DRACULA) > 0);
+        PlayerID player = getCurrentPlayer(gv);
+        assert(play[0] == "GSHMD"[player]);
+
+        LocationID move = moveToID(&play[1]);
+        if (player == PLAYER_DRACULA){
+            LocationID moves[MAX_DRACULA_MOVES];
+            int numMoves = legalDraculaMoves(gv, moves, TRUE, TRUE);
+            assert(isOneOf(move, moves, numMoves));
+        } else {
+            LocationID from = getLocation(gv, player);
+            assert(validPlace(move));
+            assert(from == UNKNOWN_LOCATION ||
+                   setHas(connectedLocationSet(gv, from, player, getRound(gv),
+                                               TRUE, TRUE, TRUE), move));
+        }
+        replayStep(replay);
+    }
+    assert(replayDone(replay) == numPlays);
+    //it stopped because it was over
+    assert(getScore(gv) <= 0 || getHealth(gv, PLAYER_DRACULA) <= 0 ||
+           getRound(gv) == maxRounds);
+    disposeReplay(replay);
+}
+
+int main()
+{
+    int g;
+
+    printf("Test generated games are legal and end when the game does\n");
+    GameGen gen = newGameGen(1);
+    int longest = 0;
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        int numPlays = generateGame(gen, game, MAX_GAME_ROUNDS);
+        checkGame(game, numPlays, MAX_GAME_ROUNDS);
+        if (numPlays > longest) longest = numPlays;
+    }
+    assert(longest > 50*NUM_PLAYERS);
+    disposeGameGen(gen);
+    printf("passed\n");
+
+    printf("Test games stop after maxRounds\n");
+    gen = newGameGen(2);
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        int numPlays = generateGame(gen, game, 5);
+        assert(numPlays <= 5*NUM_PLAYERS);
+        checkGame(game, numPlays, 5);
+    }
+    assert(generateGame(gen, game, 0) == 0 && game[0] == '\0');
+    disposeGameGen(gen);
+    printf("passed\n");
+
+    printf("Test the same seed gives the same games\n");
+    GameGen first = newGameGen(42);
+    GameGen second = newGameGen(42);
+    for (g = 0; g < 10; g++){
+        generateGame(first, game, MAX_GAME_ROUNDS);
+        generateGame(second, again, MAX_GAME_ROUNDS);
+        assert(strcmp(game, again) == 0);
+    }
+    disposeGameGen(first);
+    disposeGameGen(second);
+    printf("passed\n");
+
+    printf("Test hideDracula\n");
+    strcpy(game, "GGE.... SPA.... HBE.... MMA.... DCD.V.. "
+                 "GGE.... SPA.... HBE.... MMA.... DKLT... "
+                 "GGE.... SPA.... HBE.... MMA.... DBS.... "
+                 "GGE.... SPA.... HBE.... MMA.... DD2....");
+    hideDracula(game);
+    assert(strcmp(game, "GGE.... SPA.... HBE.... MMA.... DCD.V.. "
+                        "GGE.... SPA.... HBE.... MMA.... DC?T... "
+                        "GGE.... SPA.... HBE.... MMA.... DS?.... "
+                        "GGE.... SPA.... HBE.... MMA.... DD2....") == 0);
+    printf("passed\n");
+    return EXIT_SUCCESS;
+}
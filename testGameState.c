@@ -0,0 +1,124 @@
+// testGameState.c ... test the GameState make/unmake moves
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "GameView.h"
+#include "GameState.h"
+#include "GameGen.h"
+#include "Replay.h"
+
+#define NUM_TEST_GAMES 200
+
+static char game[MAX_GAME_LENGTH+1];
+static GameState before[MAX_GAME_ROUNDS*NUM_PLAYERS];
+static Undo undos[MAX_GAME_ROUNDS*NUM_PLAYERS];
+
+static int sameState(GameState *a, GameState *b)
+{
+    return memcmp(a, b, sizeof(GameState)) == 0;
+}
+
+// plays the game through applyMove(), checking it agrees with a GameView
+// after every play, then takes every move back again
+static void checkGame(char *plays, int numPlays)
+{
+    Replay replay = newReplay(plays);
+    GameView gv = replayView(replay);
+    GameState state, fromView;
+    initGameState(&state);
+    getGameState(gv, &fromView);
+    assert(sameState(&state, &fromView));
+
+    char *play;
+    int p;
+    for (p = 0; (play = replayNext(replay)) != NULL; p++){
+        LocationID move = moveToID(&play[1]);
+
+        //every move the generator made is one legalMoves() allows
+        LocationID moves[MAX_MOVES];
+        int numMoves = legalMoves(&state, moves);
+        int i, found = FALSE;
+        for (i = 0; i < numMoves; i++){
+            if (moves[i] == move) found = TRUE;
+        }
+        assert(found);
+
+        before[p] = state;
+        applyMove(&state, move, &undos[p]);
+        assert(state.hash == hashGameState(&state));
+        assert(state.hash != before[p].hash);
+        replayStep(replay);
+        getGameState(gv, &fromView);
+        assert(sameState(&state, &fromView));
+    }
+    assert(isGameOver(&state) == (getScore(gv) <= 0 || getHealth(gv, PLAYER_DRACULA) <= 0));
+
+    assert(p == numPlays);
+    for (p = numPlays-1; p >= 0; p--){
+        undoMove(&state, &undos[p]);
+        assert(sameState(&state, &before[p]));
+    }
+    disposeReplay(replay);
+}
+
+int main()
+{
+    printf("Test GameState is small\n");
+    assert(sizeof(GameState) <= 64);
+    printf("passed\n");
+
+    printf("Test the hash tells positions apart\n");
+    GameState a, b;
+    Undo undoA, undoB;
+    initGameState(&a);
+    initGameState(&b);
+    assert(a.hash == b.hash);
+    applyMove(&a, PARIS, &undoA);
+    applyMove(&b, MADRID, &undoB);
+    assert(a.hash != b.hash);
+    undoMove(&b, &undoB);
+    applyMove(&b, PARIS, &undoB);
+    assert(a.hash == b.hash);
+    printf("passed\n");
+
+    printf("Test applyMove agrees with GameView and undoMove takes it back\n");
+    GameGen gen = newGameGen(3);
+    int g;
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        int numPlays = generateGame(gen, game, MAX_GAME_ROUNDS);
+        checkGame(game, numPlays);
+    }
+    disposeGameGen(gen);
+    printf("passed\n");
+
+    printf("Test encounters\n");
+    GameState state;
+    Undo undo;
+    initGameState(&state);
+    applyMove(&state, GENEVA, &undo);
+    applyMove(&state, PARIS, &undo);
+    applyMove(&state, ROME, &undo);
+    applyMove(&state, MADRID, &undo);
+    applyMove(&state, STRASBOURG, &undo);   //round 0 leaves a vampire
+    int numTraps, numVamps;
+    stateMinions(&state, STRASBOURG, &numTraps, &numVamps);
+    assert(numTraps == 0 && numVamps == 1);
+    applyMove(&state, STRASBOURG, &undo);   //stakes the vampire, finds Dracula
+    assert(state.health[PLAYER_LORD_GODALMING] ==
+           GAME_START_HUNTER_LIFE_POINTS - LIFE_LOSS_DRACULA_ENCOUNTER);
+    assert(state.draculaHealth == GAME_START_BLOOD_POINTS - LIFE_LOSS_HUNTER_ENCOUNTER);
+    stateMinions(&state, STRASBOURG, &numTraps, &numVamps);
+    assert(numTraps == 0 && numVamps == 0);
+    applyMove(&state, PARIS, &undo);
+    applyMove(&state, ROME, &undo);
+    applyMove(&state, MADRID, &undo);
+    applyMove(&state, HIDE, &undo);         //round 1 leaves a trap
+    assert(trailWhere(&state, 0) == STRASBOURG);
+    stateMinions(&state, STRASBOURG, &numTraps, &numVamps);
+    assert(numTraps == 1 && numVamps == 0);
+    assert(state.round == 2 && state.score == GAME_START_SCORE - 2);
+    printf("passed\n");
+    return EXIT_SUCCESS;
+}
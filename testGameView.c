@@ -93,6 +93,83 @@ int main()
     printf("passed\n");
     disposeGameView(gv);
 
+    printf("Test for minions, hunter death and score\n");
+    PlayerMessage messages6[] = {"","","","","","","","","","","","","","","","",""};
+    gv = newGameView("GGE.... SGE.... HGE.... MGE.... DGE.V.. "
+                     "GGEVD.. SGE.... HGE.... MGE.... DHIT... "
+                     "GGETD.. SGE.... HGE.... MGE.... DD1T... "
+                     "GGETD..", messages6);
+    int numTraps, numVamps;
+    assert(getRound(gv) == 3);
+    assert(getCurrentPlayer(gv) == PLAYER_DR_SEWARD);
+    assert(getHealth(gv,PLAYER_DRACULA) == GAME_START_BLOOD_POINTS - 30);
+    assert(getHealth(gv,PLAYER_LORD_GODALMING) == 0);
+    assert(getLocation(gv,PLAYER_LORD_GODALMING) == ST_JOSEPH_AND_ST_MARYS);
+    assert(getScore(gv) == GAME_START_SCORE - 3 - SCORE_LOSS_HUNTER_HOSPITAL);
+    getMinions(gv,GENEVA,&numTraps,&numVamps);
+    assert(numTraps == 0 && numVamps == 0);
+    getHistory(gv,PLAYER_DRACULA,history);
+    assert(history[0] == DOUBLE_BACK_1);
+    assert(history[1] == HIDE);
+    assert(history[2] == GENEVA);
+    printf("passed\n");
+    disposeGameView(gv);
+
+    printf("Test appending plays matches parsing them all at once\n");
+    gv = newGameView("GGE.... SGE.... HGE.... MGE.... DGE.V.. GGEVD..", messages6);
+    gameViewAppend(gv, " SGE.... HGE.... MGE.... DHIT... ", messages6);
+    gameViewAppend(gv, "GGETD..", messages6);
+    gameViewAppend(gv, " SGE.... HGE.... MGE....", messages6);
+    gameViewAppend(gv, "DD1T... GGETD..", messages6);
+    assert(getRound(gv) == 3);
+    assert(getCurrentPlayer(gv) == PLAYER_DR_SEWARD);
+    assert(getHealth(gv,PLAYER_DRACULA) == GAME_START_BLOOD_POINTS - 30);
+    assert(getLocation(gv,PLAYER_LORD_GODALMING) == ST_JOSEPH_AND_ST_MARYS);
+    assert(getScore(gv) == GAME_START_SCORE - 3 - SCORE_LOSS_HUNTER_HOSPITAL);
+    getLocationHistory(gv,PLAYER_DRACULA,history);
+    assert(history[0] == GENEVA && history[1] == GENEVA && history[2] == GENEVA);
+    printf("passed\n");
+    disposeGameView(gv);
+
+    printf("Test a long game decodes the same in one go and play by play\n");
+    char *hunterPlays[] = {"GGETD..", "SST....", "HZUT...", "MGE....",
+                           "GSTV...", "SGED...", "HZU....", "MSTTTD."};
+    char *draculaPlays[] = {"DC?T...", "DS?.V..", "DHIT...", "DD1..M.",
+                            "DC?T.V.", "DTP....", "DGET...", "DCDT..."};
+    char longGame[40*8*NUM_PLAYERS + 1] = "";
+    int round;
+    for (round = 0; round < 40; round++){
+        for (i = 0; i < NUM_PLAYERS-1; i++){
+            strcat(longGame, hunterPlays[(round + i) % 8]);
+            longGame[strlen(longGame)-7] = "GSHM"[i];
+            strcat(longGame, " ");
+        }
+        strcat(longGame, draculaPlays[round % 8]);
+        strcat(longGame, round < 39 ? " " : "");
+    }
+    GameView whole = newGameView(longGame, NULL);
+    gv = newGameView("", NULL);
+    for (i = 0; longGame[i] != '\0'; i += 8){
+        char play[8];
+        strncpy(play, &longGame[i], 7);
+        play[7] = '\0';
+        gameViewAppend(gv, play, NULL);
+    }
+    assert(getRound(gv) == 40 && getRound(whole) == 40);
+    assert(getScore(gv) == getScore(whole));
+    for (i = 0; i < NUM_PLAYERS; i++){
+        LocationID other[TRAIL_SIZE];
+        int j;
+        assert(getHealth(gv,i) == getHealth(whole,i));
+        assert(getLocation(gv,i) == getLocation(whole,i));
+        getHistory(gv,i,history);
+        getHistory(whole,i,other);
+        for (j = 0; j < TRAIL_SIZE; j++) assert(history[j] == other[j]);
+    }
+    disposeGameView(whole);
+    disposeGameView(gv);
+    printf("passed\n");
+
     printf("Test for connections\n");
     int size, seen[NUM_MAP_LOCATIONS], *edges;
     gv = newGameView("", messages1);    
@@ -116,6 +193,19 @@ int main()
     assert(size == 1);
     assert(edges[0] == ATHENS);
     free(edges);
+    printf("Checking Paris rail connections three stops out\n");
+    LocationSet reachable = connectedLocationSet(gv,PARIS,PLAYER_MINA_HARKER,0,0,1,0);
+    assert(setSize(reachable) == 10);
+    assert(setHas(reachable,PARIS)); assert(setHas(reachable,MADRID));
+    assert(setHas(reachable,COLOGNE)); assert(setHas(reachable,FRANKFURT));
+    assert(!setHas(reachable,MILAN));
+    reachable = connectedLocationSet(gv,PARIS,PLAYER_LORD_GODALMING,3,0,1,0);
+    assert(setSize(reachable) == 10);
+    reachable = connectedLocationSet(gv,PARIS,PLAYER_LORD_GODALMING,4,0,1,0);
+    assert(setSize(reachable) == 1);
+    printf("Checking nothing is connected to an unknown location\n");
+    reachable = connectedLocationSet(gv,UNKNOWN_LOCATION,PLAYER_DRACULA,1,1,1,1);
+    assert(setIsEmpty(reachable));
     printf("passed\n");
     disposeGameView(gv);
     return 0;
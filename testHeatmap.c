@@ -0,0 +1,139 @@
+// testHeatmap.c ... test the hunters' Heatmap of where Dracula is
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include "GameView.h"
+#include "GameState.h"
+#include "GameGen.h"
+#include "Replay.h"
+#include "Belief.h"
+#include "Heatmap.h"
+
+#define NUM_TEST_GAMES 100
+#define NUM_SAMPLES    100000
+#define CLOSE          0.0001
+
+static char game[MAX_GAME_LENGTH+1];
+
+// plays the game a play at a time, checking the heatmap adds up to 1,
+// only over places the belief allows, and Dracula is never somewhere
+// it has no chance of him being
+static void checkGame(double *totalChance, long *numChances)
+{
+    Replay replay = newReplay(game);
+    Belief belief;
+    Heatmap heat;
+    initBelief(&belief);
+    initHeatmap(&heat);
+    int v;
+    while (replayNext(replay) != NULL){
+        heatAppend(&heat, &belief, replayHidden(replay), NULL);
+        replayStep(replay);
+
+        GameState state;
+        getGameState(replayView(replay), &state);
+        LocationID where = trailWhere(&state, 0);
+        if (!validPlace(where)){
+            continue;
+        }
+        const float *chance = heatWhere(&heat);
+        double total = 0;
+        for (v = 0; v < HEAT_SIZE; v++){
+            assert(chance[v] >= 0);
+            assert(chance[v] == 0 || setHas(beliefWhere(&belief), v));
+            total += chance[v];
+        }
+        assert(fabs(total - 1) < CLOSE);
+        assert(chance[where] > 0);
+        *totalChance += chance[where];
+        (*numChances) ++;
+    }
+    disposeReplay(replay);
+}
+
+int main()
+{
+    Belief belief;
+    Heatmap heat;
+    const float *chance;
+
+    printf("Test Dracula is always somewhere the heatmap gives a chance\n");
+    GameGen gen = newGameGen(12);
+    double totalChance = 0;
+    long numChances = 0;
+    int g;
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        generateGame(gen, game, MAX_GAME_ROUNDS);
+        checkGame(&totalChance, &numChances);
+    }
+    disposeGameGen(gen);
+    printf("%.2f chance on average where he was\n", totalChance / numChances);
+    printf("passed\n");
+
+    printf("Test a hidden move shares out the chance evenly\n");
+    initBelief(&belief);
+    initHeatmap(&heat);
+    heatAppend(&heat, &belief, "GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                                "GLV.... SLO.... HNS.... MST.... DC?T...", NULL);
+    chance = heatWhere(&heat);
+    assert(fabs(chance[GALATZ] - 0.5) < CLOSE);
+    assert(fabs(chance[KLAUSENBURG] - 0.5) < CLOSE);
+    //Galatz leads to 4 places and Klausenburg to 6, Bucharest is next to
+    //both, and Castle Dracula's on the trail
+    heatAppend(&heat, &belief, "GLO.... SLO.... HNS.... MST.... DC?....", NULL);
+    chance = heatWhere(&heat);
+    assert(chance[CASTLE_DRACULA] == 0);
+    assert(fabs(chance[CONSTANTA] / chance[SZEGED] - 6.0/4) < CLOSE);
+    assert(fabs(chance[BUCHAREST] - chance[CONSTANTA] - chance[SZEGED]) < CLOSE);
+    printf("passed\n");
+
+    printf("Test a prior weights where he goes\n");
+    float prior[HEAT_SIZE];
+    int v;
+    for (v = 0; v < HEAT_SIZE; v++){
+        prior[v] = v < NUM_MAP_LOCATIONS ? 1 : 0;
+    }
+    prior[GALATZ] = 3;
+    initBelief(&belief);
+    initHeatmap(&heat);
+    heatAppend(&heat, &belief, "GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                                "GLV.... SLO.... HNS.... MST.... DC?T...", prior);
+    chance = heatWhere(&heat);
+    assert(fabs(chance[GALATZ] - 0.75) < CLOSE);
+    assert(fabs(chance[KLAUSENBURG] - 0.25) < CLOSE);
+    printf("passed\n");
+
+    printf("Test a hunter not finding him moves the chance elsewhere\n");
+    heatAppend(&heat, &belief, "GGA....", prior);
+    chance = heatWhere(&heat);
+    assert(chance[GALATZ] == 0);
+    assert(fabs(chance[KLAUSENBURG] - 1) < CLOSE);
+    printf("passed\n");
+
+    printf("Test samples come up as often as the heatmap says\n");
+    initBelief(&belief);
+    initHeatmap(&heat);
+    heatAppend(&heat, &belief, "GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                                "GLV.... SLO.... HNS.... MST.... DC?T... "
+                                "GLO.... SLO.... HNS.... MST.... DC?....", NULL);
+    chance = heatWhere(&heat);
+    int counts[NUM_MAP_LOCATIONS] = {0};
+    uint64_t seed = 88172645463325252ULL;
+    int s;
+    for (s = 0; s < NUM_SAMPLES; s++){
+        LocationID where = heatSample(&heat, &seed);
+        assert(validPlace(where));
+        counts[where] ++;
+    }
+    for (v = 0; v < NUM_MAP_LOCATIONS; v++){
+        double expected = chance[v] * NUM_SAMPLES;
+        assert(chance[v] > 0 || counts[v] == 0);
+        assert(fabs(counts[v] - expected) < 5 * sqrt(expected) + 1);
+    }
+    printf("passed\n");
+
+    return EXIT_SUCCESS;
+}
@@ -55,6 +55,7 @@ int main()
     giveMeTheTrail(hv,PLAYER_DR_SEWARD,history);
     assert(history[0] == ATLANTIC_OCEAN);
     assert(history[1] == UNKNOWN_LOCATION);
+    assert(setEquals(whereMightDraculaBe(hv), setOf(GENEVA)));
     printf("passed\n");        
     disposeHunterView(hv);
 
@@ -106,6 +107,20 @@ int main()
     free(edges);
     disposeHunterView(hv);
 
+    printf("Checking first moves can be anywhere\n");
+    LocationID moves[NUM_MAP_LOCATIONS];
+    hv = newHunterView("", messages1);
+    size = whereCanIgoInto(hv,moves,1,1,1);
+    assert(size == NUM_MAP_LOCATIONS);
+    for (i = 0; i < size; i++) assert(moves[i] == i);
+    size = whereCanTheyGoInto(hv,moves,PLAYER_MINA_HARKER,1,1,1);
+    assert(size == NUM_MAP_LOCATIONS);
+    printf("Checking Dracula can start anywhere but the hospital\n");
+    size = whereCanTheyGoInto(hv,moves,PLAYER_DRACULA,1,1,1);
+    assert(size == NUM_MAP_LOCATIONS - 1);
+    for (i = 0; i < size; i++) assert(moves[i] != ST_JOSEPH_AND_ST_MARYS);
+    disposeHunterView(hv);
+
     printf("passed\n");
     return 0;
 }
@@ -0,0 +1,129 @@
+// testMcts.c ... test the hunters' Monte Carlo tree search
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "Globals.h"
+#include "Game.h"
+#include "HunterView.h"
+#include "GameState.h"
+#include "ThreadPool.h"
+#include "Mcts.h"
+
+#define SEARCH_MSECS 200
+#define NUM_SEARCH_THREADS 4
+
+// what the search has told the game engine
+static char registered[3];
+static int numRegistered = 0;
+
+void registerBestPlay(char *play, PlayerMessage message)
+{
+    strncpy(registered, play, 2);
+    registered[2] = '\0';
+    numRegistered ++;
+}
+
+static long nowMsecs(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec*1000L + t.tv_nsec/1000000L;
+}
+
+int main()
+{
+    PlayerMessage messages[20] = {""};
+    Mcts mcts = newMcts(1 << 16, 1);
+
+    printf("Test a legal move is registered in time\n");
+    HunterView hv = newHunterView("GMN.... SPL.... HAM.... MPA.... DC?.V.. "
+                                  "GLV.... SLO.... HNS.... MST.... DC?T...", messages);
+    long start = nowMsecs();
+    LocationID move = mctsHunterMove(mcts, hv, SEARCH_MSECS);
+    assert(nowMsecs() - start < SEARCH_MSECS + 50);
+    assert(numRegistered > 0);
+    assert(abbrevToID(registered) == move);
+    LocationID moves[MAX_MOVES];
+    int i, numMoves = whereCanIgoInto(hv, moves, TRUE, TRUE, TRUE);
+    for (i = 0; i < numMoves && moves[i] != move; i++);
+    assert(i < numMoves);
+    assert(mctsSimulations(mcts) > 0 && mctsNodes(mcts) > 1);
+    printf("%ld simulations, %d nodes\n", mctsSimulations(mcts), mctsNodes(mcts));
+    printf("passed\n");
+
+    printf("Test a hunter moves onto a weak Dracula\n");
+    GameState state;
+    Undo undo;
+    initGameState(&state);
+    applyMove(&state, PARIS, &undo);
+    applyMove(&state, MADRID, &undo);
+    applyMove(&state, ROME, &undo);
+    applyMove(&state, VIENNA, &undo);
+    applyMove(&state, STRASBOURG, &undo);
+    //only one more encounter to go
+    state.draculaHealth = LIFE_LOSS_HUNTER_ENCOUNTER;
+    state.hash = hashGameState(&state);
+    move = mctsSearch(mcts, &state, SEARCH_MSECS);
+    assert(move == STRASBOURG);
+    assert(abbrevToID(registered) == STRASBOURG);
+    printf("passed\n");
+
+    printf("Test the same with a pool of threads searching\n");
+    ThreadPool pool = newThreadPool(NUM_SEARCH_THREADS);
+    mctsSetPool(mcts, pool);
+    numRegistered = 0;
+    start = nowMsecs();
+    move = mctsSearch(mcts, &state, SEARCH_MSECS);
+    //nothing is registered once the search has stopped
+    int registeredBy = numRegistered;
+    assert(nowMsecs() - start < SEARCH_MSECS + 50);
+    assert(move == STRASBOURG);
+    assert(abbrevToID(registered) == STRASBOURG);
+    assert(mctsSimulations(mcts) > 0 && mctsNodes(mcts) > 1);
+    struct timespec pause = {0, 20000000};
+    nanosleep(&pause, NULL);
+    assert(numRegistered == registeredBy);
+    printf("%ld simulations, %d nodes\n", mctsSimulations(mcts), mctsNodes(mcts));
+    printf("passed\n");
+
+    printf("Test pondering carries on into the next search\n");
+    GameState next;
+    giveMeTheState(hv, &state);
+    move = mctsSearch(mcts, &state, SEARCH_MSECS);
+    int searched = mctsNodes(mcts);
+    mctsPonder(mcts, move);
+    nanosleep(&pause, NULL);
+    registeredBy = numRegistered;
+    nanosleep(&pause, NULL);
+    assert(numRegistered == registeredBy);   //it's not our turn
+    mctsStopPondering(mcts);
+    int pondered = mctsNodes(mcts) - searched;
+    assert(pondered > 0);
+    next = state;
+    applyMove(&next, move, &undo);
+    mctsSearch(mcts, &next, 1);
+    assert(mctsNodes(mcts) >= pondered);
+    printf("%d nodes pondered\n", pondered);
+    printf("passed\n");
+
+    printf("Test the tree is thrown away when the game goes another way\n");
+    giveMeTheState(hv, &state);
+    move = mctsSearch(mcts, &state, SEARCH_MSECS);
+    searched = mctsNodes(mcts);
+    mctsPonder(mcts, move);
+    nanosleep(&pause, NULL);
+    numMoves = legalMoves(&state, moves);
+    next = state;
+    applyMove(&next, moves[0] != move ? moves[0] : moves[1], &undo);
+    mctsSearch(mcts, &next, 1);
+    assert(mctsNodes(mcts) < searched);
+    printf("passed\n");
+
+    disposeHunterView(hv);
+    disposeMcts(mcts);
+    disposeThreadPool(pool);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,187 @@
+// testParticleFilter.c ... test the hunters' particles of Dracula's trail
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "GameView.h"
+#include "GameState.h"
+#include "GameGen.h"
+#include "Replay.h"
+#include "Map.h"
+#include "Belief.h"
+#include "ParticleFilter.h"
+
+#define NUM_TEST_GAMES 50
+#define NUM_PARTICLES  256
+
+static char game[MAX_GAME_LENGTH+1];
+
+static LocationID place(uint64_t trail, int i)
+{
+    return (int8_t)(trail >> (8*i));
+}
+
+// updates the belief then the particles with some plays
+static void append(Belief *belief, ParticleFilter filter, char *plays)
+{
+    int numPlays = countPlays(plays);
+    Play batch[MAX_GAME_LENGTH/PLAY_LENGTH + 1];
+    decodePlays(plays, numPlays, batch);
+    int p;
+    for (p = 0; p < numPlays; p++){
+        beliefPlay(belief, &batch[p]);
+        particlePlay(filter, belief, &batch[p]);
+    }
+}
+
+// whether every particle has Dracula somewhere in where, movesAgo moves ago
+static int allIn(ParticleFilter filter, int movesAgo, LocationSet where)
+{
+    uint64_t seed = 88172645463325252ULL;
+    int i;
+    for (i = 0; i < 4*NUM_PARTICLES; i++){
+        if (!setHas(where, place(particleSample(filter, &seed), movesAgo))){
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// plays the game a play at a time, checking every particle the filter
+// holds fits the belief and keeps to the roads and seas; returns how
+// many of Dracula's moves some particle had him in the right place
+static int checkGame(ParticleFilter filter, int *numMoves)
+{
+    Replay replay = newReplay(game);
+    Map map = newMap();
+    Belief belief;
+    initBelief(&belief);
+    int found = 0;
+    char *play;
+    int i;
+    while ((play = replayHidden(replay)) != NULL){
+        append(&belief, filter, play);
+        int dracula = play[0] == 'D';
+        replayStep(replay);
+        if (numParticles(filter) == 0){
+            continue;
+        }
+
+        GameState state;
+        getGameState(replayView(replay), &state);
+        uint64_t seed = replayDone(replay);
+        int sawHim = FALSE, s;
+        for (s = 0; s < NUM_PARTICLES; s++){
+            uint64_t trail = particleSample(filter, &seed);
+            for (i = 0; i < TRAIL_SIZE; i++){
+                LocationID where = place(trail, i);
+                if (!validPlace(where)){
+                    assert(!validPlace(trailWhere(&state, i)));
+                    continue;
+                }
+                assert(setHas(beliefTrail(&belief, i), where));
+                LocationID before = i+1 < TRAIL_SIZE ? place(trail, i+1) : NOWHERE;
+                if (validPlace(before) && belief.moves[i] != TELEPORT && before != where){
+                    assert(setHas(setUnion(connectionSet(map, before, ROAD),
+                                           connectionSet(map, before, BOAT)), where));
+                }
+            }
+            sawHim |= place(trail, 0) == trailWhere(&state, 0);
+        }
+        if (dracula){
+            found += sawHim;
+            (*numMoves) ++;
+        }
+    }
+    disposeReplay(replay);
+    return found;
+}
+
+int main()
+{
+    Belief belief;
+    ParticleFilter filter;
+
+    printf("Test particles keep to the rules and the belief\n");
+    GameGen gen = newGameGen(13);
+    int found = 0, numMoves = 0, g;
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        generateGame(gen, game, MAX_GAME_ROUNDS);
+        filter = newParticleFilter(NUM_PARTICLES, g);
+        found += checkGame(filter, &numMoves);
+        disposeParticleFilter(filter);
+    }
+    disposeGameGen(gen);
+    printf("a particle had him right after %d%% of his moves\n", 100*found / numMoves);
+    assert(2*found > numMoves);
+    printf("passed\n");
+
+    printf("Test particles follow where he could have gone\n");
+    initBelief(&belief);
+    filter = newParticleFilter(NUM_PARTICLES, 1);
+    append(&belief, filter, "GMN.... SPL.... HAM.... MPA.... ");
+    assert(numParticles(filter) == 0);
+    append(&belief, filter, "DCD.V.. GLV.... SLO.... HNS.... MST.... DC?T...");
+    assert(numParticles(filter) == NUM_PARTICLES);
+    LocationSet nearCastle = setOf(GALATZ);
+    setAdd(&nearCastle, KLAUSENBURG);
+    assert(allIn(filter, 0, nearCastle));
+    assert(allIn(filter, 1, setOf(CASTLE_DRACULA)));
+    assert(!allIn(filter, 0, setOf(GALATZ)));
+    assert(!allIn(filter, 0, setOf(KLAUSENBURG)));
+    printf("passed\n");
+
+    printf("Test particles a hunter rules out are replaced\n");
+    append(&belief, filter, "GGA....");
+    assert(numParticles(filter) == NUM_PARTICLES);
+    assert(allIn(filter, 0, setOf(KLAUSENBURG)));
+    printf("passed\n");
+
+    printf("Test a hide keeps him where the particle had him\n");
+    append(&belief, filter, "SLO.... HNS.... MST.... DHI.... GBC.... SLO.... HNS.... MST.... DC?....");
+    assert(allIn(filter, 1, setOf(KLAUSENBURG)));
+    assert(allIn(filter, 2, setOf(KLAUSENBURG)));
+    LocationSet fromKlausenburg = setMinus(connectionSet(newMap(), KLAUSENBURG, ROAD),
+                                           setOf(CASTLE_DRACULA));
+    setRemove(&fromKlausenburg, KLAUSENBURG);
+    assert(allIn(filter, 0, fromKlausenburg));
+    printf("passed\n");
+
+    printf("Test a guess fills in the hunters' state\n");
+    GameView gv = newGameView("GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                              "GLV.... SLO.... HNS.... MST.... DC?T... "
+                              "GGA.... SLO.... HNS.... MST.... DHI.... "
+                              "GBC.... SLO.... HNS.... MST.... DC?....", NULL);
+    GameState state, guess;
+    getGameState(gv, &state);
+    disposeGameView(gv);
+    uint64_t seed = 1;
+    guess = state;
+    assert(particleGuess(filter, &guess, &seed));
+    assert(trailMove(&guess, 0) == trailWhere(&guess, 0));
+    assert(setHas(fromKlausenburg, trailWhere(&guess, 0)));
+    assert(trailMove(&guess, 1) == HIDE);
+    assert(trailWhere(&guess, 1) == KLAUSENBURG);
+    assert(trailMove(&guess, 2) == KLAUSENBURG);
+    assert(trailWhere(&guess, 3) == CASTLE_DRACULA);
+    assert(guess.hash == hashGameState(&guess));
+    assert(guess.curr == state.curr && guess.score == state.score);
+    printf("passed\n");
+
+    printf("Test copies hold the same particles\n");
+    ParticleFilter copy = newParticleFilter(NUM_PARTICLES, 2);
+    assert(!particleGuess(copy, &state, &seed));
+    copyParticles(copy, filter);
+    assert(numParticles(copy) == NUM_PARTICLES);
+    uint64_t seed1 = 5, seed2 = 5;
+    int i;
+    for (i = 0; i < NUM_PARTICLES; i++){
+        assert(particleSample(copy, &seed1) == particleSample(filter, &seed2));
+    }
+    disposeParticleFilter(copy);
+    disposeParticleFilter(filter);
+    printf("passed\n");
+
+    return EXIT_SUCCESS;
+}
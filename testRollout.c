@@ -0,0 +1,87 @@
+// testRollout.c ... test the random playouts
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "GameView.h"
+#include "GameState.h"
+#include "GameGen.h"
+#include "Rollout.h"
+
+#define NUM_TEST_GAMES   50
+#define SAMPLES          4000   // random moves asked for in each position
+
+static char game[MAX_GAME_LENGTH+1];
+
+// every move randomMove() picks is legal, and given long enough it
+// picks every legal move
+static void checkMoves(const GameState *state, uint64_t *random, int heuristic)
+{
+    LocationID moves[MAX_MOVES];
+    int numMoves = legalMoves(state, moves);
+    LocationSet legal = setEmpty(), picked = setEmpty();
+    int i;
+    for (i = 0; i < numMoves; i++){
+        setAdd(&legal, moves[i]);
+    }
+    for (i = 0; i < SAMPLES; i++){
+        LocationID move = randomMove(state, random, heuristic);
+        assert(setHas(legal, move));
+        setAdd(&picked, move);
+    }
+    if (!heuristic){
+        assert(setEquals(picked, legal));
+    }
+}
+
+int main()
+{
+    uint64_t random = 1;
+
+    printf("Test random moves are the legal moves\n");
+    GameGen gen = newGameGen(5);
+    int g;
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        int numPlays = generateGame(gen, game, MAX_GAME_ROUNDS);
+        //a position part way through the game
+        game[(numPlays/2)*PLAY_LENGTH] = '\0';
+        GameView gv = newGameView(game, NULL);
+        GameState state;
+        getGameState(gv, &state);
+        checkMoves(&state, &random, FALSE);
+        checkMoves(&state, &random, TRUE);
+        disposeGameView(gv);
+    }
+    disposeGameGen(gen);
+    printf("passed\n");
+
+    printf("Test a playout stops after so many moves\n");
+    GameState state;
+    initGameState(&state);
+    assert(playout(&state, &random, 12, FALSE) == 12);
+    assert(state.round == 2 && state.curr == 2);
+    assert(state.hash == hashGameState(&state));
+    printf("passed\n");
+
+    printf("Test playouts to the end finish the game\n");
+    for (g = 0; g < 100; g++){
+        initGameState(&state);
+        int played = playout(&state, &random, PLAYOUT_TO_END, g & 1);
+        assert(played > 0 && isGameOver(&state));
+        assert(state.hash == hashGameState(&state));
+    }
+    printf("passed\n");
+
+    printf("Test a hunter who can reach Dracula does, with the heuristic\n");
+    Undo undo;
+    initGameState(&state);
+    applyMove(&state, PARIS, &undo);
+    applyMove(&state, MADRID, &undo);
+    applyMove(&state, ROME, &undo);
+    applyMove(&state, VIENNA, &undo);
+    applyMove(&state, STRASBOURG, &undo);
+    assert(randomMove(&state, &random, TRUE) == STRASBOURG);
+    printf("passed\n");
+    return EXIT_SUCCESS;
+}
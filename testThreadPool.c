@@ -0,0 +1,67 @@
+// testThreadPool.c ... test the ThreadPool ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "Globals.h"
+#include "ThreadPool.h"
+
+#define NUM_THREADS   4
+#define TREE_DEPTH    14     // 2^15-1 tasks in all
+#define MANY_TASKS    5000   // more than a deque holds
+
+static ThreadPool pool;
+static long counted;
+
+// counts itself, then splits into two smaller tasks
+static void spawnTree(void *arg)
+{
+    long depth = (long)arg;
+    __atomic_add_fetch(&counted, 1, __ATOMIC_RELAXED);
+    if (depth > 0){
+        poolSubmit(pool, spawnTree, (void *)(depth - 1));
+        poolSubmit(pool, spawnTree, (void *)(depth - 1));
+    }
+}
+
+static void countOne(void *arg)
+{
+    __atomic_add_fetch((long *)arg, 1, __ATOMIC_RELAXED);
+}
+
+int main()
+{
+    printf("Test a pool has its threads\n");
+    pool = newThreadPool(NUM_THREADS);
+    assert(poolThreads(pool) == NUM_THREADS);
+    poolWait(pool);   //nothing to wait for
+    printf("passed\n");
+
+    printf("Test tasks submitted from tasks all run before poolWait returns\n");
+    counted = 0;
+    poolSubmit(pool, spawnTree, (void *)(long)TREE_DEPTH);
+    poolWait(pool);
+    assert(counted == (1L << (TREE_DEPTH+1)) - 1);
+    printf("passed\n");
+
+    printf("Test the pool can be waited on again, with more tasks than fit\n");
+    long count = 0;
+    int i;
+    for (i = 0; i < MANY_TASKS; i++){
+        poolSubmit(pool, countOne, &count);
+    }
+    poolWait(pool);
+    assert(count == MANY_TASKS);
+    disposeThreadPool(pool);
+    printf("passed\n");
+
+    printf("Test a pool of one per core\n");
+    pool = newThreadPool(0);
+    assert(poolThreads(pool) >= 1);
+    counted = 0;
+    poolSubmit(pool, spawnTree, (void *)4L);
+    disposeThreadPool(pool);   //finishes the tasks first
+    assert(counted == 31);
+    printf("passed\n");
+    return EXIT_SUCCESS;
+}
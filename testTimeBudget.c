@@ -0,0 +1,64 @@
+// testTimeBudget.c ... test the TimeBudget
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <time.h>
+#include "Globals.h"
+#include "TimeBudget.h"
+
+#define MSEC   1000000L
+
+static void sleepMsecs(int msecs)
+{
+    struct timespec pause = {0, msecs*MSEC};
+    nanosleep(&pause, NULL);
+}
+
+int main()
+{
+    TimeBudget budget;
+
+    printf("Test a budget runs out at its deadline\n");
+    budgetStart(&budget, 30);
+    assert(!budgetExpired(&budget));
+    assert(budgetRemaining(&budget) > 20*MSEC && budgetRemaining(&budget) <= 30*MSEC);
+    sleepMsecs(40);
+    assert(budgetExpired(&budget));
+    assert(budgetRemaining(&budget) == 0);
+    printf("passed\n");
+
+    printf("Test iterations are timed\n");
+    budgetStart(&budget, 1000);
+    assert(budgetAllowsNext(&budget));      //nothing to go on yet
+    budgetIterationStarted(&budget);
+    sleepMsecs(10);
+    budgetIterationDone(&budget);
+    assert(budget.lastCost >= 10*MSEC && budget.lastCost < 100*MSEC);
+    printf("passed\n");
+
+    printf("Test the next iteration's cost is guessed from the last two\n");
+    budget.previousCost = 0;
+    budget.lastCost = 10*MSEC;
+    assert(budgetNextCost(&budget) > budget.lastCost);   //one to go on
+    budget.previousCost = 10*MSEC;
+    budget.lastCost = 30*MSEC;
+    assert(budgetNextCost(&budget) == 90*MSEC);          //grows 3 times
+    budget.previousCost = 30*MSEC;
+    budget.lastCost = 10*MSEC;
+    assert(budgetNextCost(&budget) == 10*MSEC);          //never less
+    budget.previousCost = 1;
+    budget.lastCost = 10*MSEC;
+    assert(budgetNextCost(&budget) < 1000*MSEC);         //never hugely more
+    printf("passed\n");
+
+    printf("Test an iteration that can't finish isn't started\n");
+    budgetStart(&budget, 100);
+    budget.previousCost = 10*MSEC;
+    budget.lastCost = 40*MSEC;       //the next would take 160ms
+    assert(!budgetAllowsNext(&budget));
+    budget.lastCost = 20*MSEC;       //80ms fits
+    assert(budgetAllowsNext(&budget));
+    printf("passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,174 @@
+// testTrails.c ... test counting and listing Dracula's possible trails
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "GameView.h"
+#include "GameState.h"
+#include "GameGen.h"
+#include "Replay.h"
+#include "Map.h"
+#include "Belief.h"
+#include "Trails.h"
+
+#define NUM_TEST_GAMES 30
+#define MAX_PRODUCT    20000     // biggest belief checked the slow way
+#define MAX_LISTED     20000
+
+static char game[MAX_GAME_LENGTH+1];
+static uint64_t listed[MAX_LISTED];
+
+static LocationID place(uint64_t trail, int i)
+{
+    return (int8_t)(trail >> (8*i));
+}
+
+static int nextTo(LocationID from, LocationID to)
+{
+    Map map = newMap();
+    return from == to || setHas(setUnion(connectionSet(map, from, ROAD),
+                                         connectionSet(map, from, BOAT)), to);
+}
+
+// whether a whole trail keeps to Dracula's rules, checked move by move
+static int keepsRules(const Belief *belief, LocationID where[TRAIL_SIZE], int oldest)
+{
+    int i, j;
+    for (i = oldest; i >= 0; i--){
+        LocationID move = belief->moves[i];
+        LocationID from = i < oldest ? where[i+1] : NOWHERE;
+        if (validPlace(from) && move != TELEPORT && !nextTo(from, where[i])){
+            return FALSE;
+        }
+        if (move == CITY_UNKNOWN || move == SEA_UNKNOWN){
+            for (j = i+1; j <= oldest && j <= i+TRAIL_SIZE-1; j++){
+                if (where[j] == where[i]) return FALSE;
+            }
+        } else if (move == HIDE){
+            if (validPlace(from) && where[i] != from) return FALSE;
+        } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5){
+            j = i + move - DOUBLE_BACK_1 + 1;
+            if (j <= oldest && where[i] != where[j]) return FALSE;
+        } else if (move == TELEPORT){
+            if (where[i] != CASTLE_DRACULA) return FALSE;
+        } else if (where[i] != move){
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// counts the trails that keep the rules among every choice of a place
+// the belief allows for each move
+static long slowCount(const Belief *belief, LocationID where[TRAIL_SIZE],
+                      int i, int oldest)
+{
+    if (i < 0){
+        return keepsRules(belief, where, oldest);
+    }
+    long count = 0;
+    LocationSet options = beliefTrail(belief, i);
+    while (!setIsEmpty(options)){
+        where[i] = setPopFirst(&options);
+        count += slowCount(belief, where, i-1, oldest);
+    }
+    return count;
+}
+
+// checks the count and list against the slow count, where that's quick
+// enough, and that the real trail is listed; returns FALSE if not checked
+static int checkBelief(const Belief *belief, const GameState *real)
+{
+    int oldest = -1, i;
+    long product = 1;
+    for (i = 0; i < TRAIL_SIZE && belief->moves[i] != UNKNOWN_LOCATION; i++){
+        oldest = i;
+        product *= setSize(beliefTrail(belief, i));
+    }
+    if (oldest < 0 || product > MAX_PRODUCT){
+        return FALSE;
+    }
+    LocationID where[TRAIL_SIZE];
+    long count = slowCount(belief, where, oldest, oldest);
+    assert(count >= 1);
+    assert(countTrails(belief, MAX_LISTED) == count);
+    int numListed = listTrails(belief, listed, MAX_LISTED);
+    assert(numListed == count);
+    int sawReal = FALSE, t;
+    for (t = 0; t < numListed; t++){
+        int same = TRUE;
+        for (i = 0; i <= oldest; i++){
+            where[i] = place(listed[t], i);
+            same &= where[i] == trailWhere(real, i);
+        }
+        assert(keepsRules(belief, where, oldest));
+        sawReal |= same;
+    }
+    assert(sawReal);
+    if (count > 1){
+        assert(countTrails(belief, count-1) == TOO_MANY_TRAILS);
+        assert(listTrails(belief, listed, count-1) == TOO_MANY_TRAILS);
+    }
+    return TRUE;
+}
+
+int main()
+{
+    Belief belief;
+
+    printf("Test the trails counted and listed are every one that fits\n");
+    GameGen gen = newGameGen(14);
+    int numChecked = 0, g;
+    for (g = 0; g < NUM_TEST_GAMES; g++){
+        generateGame(gen, game, MAX_GAME_ROUNDS);
+        Replay replay = newReplay(game);
+        initBelief(&belief);
+        while (replayNext(replay) != NULL){
+            beliefAppend(&belief, replayHidden(replay));
+            replayStep(replay);
+            GameState real;
+            getGameState(replayView(replay), &real);
+            numChecked += checkBelief(&belief, &real);
+        }
+        disposeReplay(replay);
+    }
+    disposeGameGen(gen);
+    printf("%d beliefs checked\n", numChecked);
+    assert(numChecked > 0);
+    printf("passed\n");
+
+    printf("Test no trails before he has moved\n");
+    initBelief(&belief);
+    assert(countTrails(&belief, MAX_LISTED) == 0);
+    assert(listTrails(&belief, listed, MAX_LISTED) == 0);
+    printf("passed\n");
+
+    printf("Test a hidden move from the castle\n");
+    beliefAppend(&belief, "GMN.... SPL.... HAM.... MPA.... DCD.V.. "
+                          "GLV.... SLO.... HNS.... MST.... DC?T...");
+    assert(countTrails(&belief, MAX_LISTED) == 2);
+    assert(listTrails(&belief, listed, MAX_LISTED) == 2);
+    assert(place(listed[0], 1) == CASTLE_DRACULA && place(listed[1], 1) == CASTLE_DRACULA);
+    assert(place(listed[0], 0) != place(listed[1], 0));
+    assert(place(listed[0], 2) == NOWHERE);
+    assert(countTrails(&belief, 1) == TOO_MANY_TRAILS);
+    printf("passed\n");
+
+    printf("Test a hide and double back follow the trail\n");
+    beliefAppend(&belief, "GLO.... SLO.... HNS.... MST.... DHI.... "
+                          "GLO.... SLO.... HNS.... MST.... DC?.... "
+                          "GLO.... SLO.... HNS.... MST.... DD3....");
+    int n = listTrails(&belief, listed, MAX_LISTED);
+    assert(n > 2);
+    int t;
+    for (t = 0; t < n; t++){
+        assert(place(listed[t], 0) == place(listed[t], 2));
+        assert(place(listed[t], 2) == place(listed[t], 3));
+        assert(place(listed[t], 4) == CASTLE_DRACULA);
+    }
+    assert(countTrails(&belief, MAX_LISTED) == n);
+    printf("passed\n");
+
+    return EXIT_SUCCESS;
+}
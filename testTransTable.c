@@ -0,0 +1,114 @@
+// testTransTable.c ... test the TransTable ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "Globals.h"
+#include "TransTable.h"
+
+#define STRESS_THREADS   8
+#define STRESS_OPS       2000000
+#define STRESS_KEYS      4096   // many more keys than entries, so they fight
+
+static TransTable shared;
+
+// a key that isn't small, from a number
+static uint64_t stressKey(uint64_t n)
+{
+    return (n + 1) * 0x9E3779B97F4A7C15ULL;
+}
+
+// stores entries whose contents all follow from their key, and checks
+// every entry found is whole
+static void *stress(void *arg)
+{
+    uint64_t seed = (uintptr_t)arg;
+    int i;
+    for (i = 0; i < STRESS_OPS; i++){
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t key = stressKey((seed >> 33) % STRESS_KEYS);
+        int depth, value, bound;
+        LocationID move;
+        if (seed & (1ULL << 20)){
+            ttStore(shared, key, (key >> 8) & 63, (int32_t)(key >> 32),
+                    key % 3, key % NUM_MAP_LOCATIONS);
+        } else if (ttProbe(shared, key, &depth, &value, &bound, &move)){
+            assert(depth == (int)((key >> 8) & 63));
+            assert(value == (int32_t)(key >> 32));
+            assert(bound == (int)(key % 3));
+            assert(move == (LocationID)(key % NUM_MAP_LOCATIONS));
+        }
+    }
+    return NULL;
+}
+
+int main()
+{
+    int depth, value, bound;
+    LocationID move;
+
+    printf("Test storing and finding positions\n");
+    TransTable table = newTransTable(4);
+    assert(!ttProbe(table, 0x1234, &depth, &value, &bound, &move));
+    ttStore(table, 0x1234, 3, -7, BOUND_LOWER, PARIS);
+    assert(ttProbe(table, 0x1234, &depth, &value, &bound, &move));
+    assert(depth == 3 && value == -7 && bound == BOUND_LOWER && move == PARIS);
+    //same slot, different position
+    assert(!ttProbe(table, 0x1234 + 16, &depth, &value, &bound, &move));
+    printf("passed\n");
+
+    printf("Test depth-preferred replacement\n");
+    ttStore(table, 0x1234 + 16, 2, 5, BOUND_EXACT, ROME);
+    assert(ttProbe(table, 0x1234, &depth, &value, &bound, &move));
+    assert(!ttProbe(table, 0x1234 + 16, &depth, &value, &bound, &move));
+    ttStore(table, 0x1234 + 32, 4, 5, BOUND_EXACT, ROME);
+    assert(!ttProbe(table, 0x1234, &depth, &value, &bound, &move));
+    assert(ttProbe(table, 0x1234 + 32, &depth, &value, &bound, &move));
+    assert(depth == 4 && move == ROME);
+    //the same position from a shallower search too
+    ttStore(table, 0x1234 + 32, 1, 9, BOUND_UPPER, MADRID);
+    assert(ttProbe(table, 0x1234 + 32, &depth, &value, &bound, &move));
+    assert(depth == 4 && value == 5 && bound == BOUND_EXACT && move == ROME);
+    ttStore(table, 0x1234 + 32, 4, 9, BOUND_UPPER, MADRID);
+    assert(ttProbe(table, 0x1234 + 32, &depth, &value, &bound, &move));
+    assert(depth == 4 && value == 9 && bound == BOUND_UPPER && move == MADRID);
+    //but an exact value for it replaces a bound
+    ttStore(table, 0x1234 + 32, 2, 7, BOUND_LOWER, PARIS);
+    assert(ttProbe(table, 0x1234 + 32, &depth, &value, &bound, &move));
+    assert(depth == 4 && move == MADRID);
+    ttStore(table, 0x1234 + 32, 2, 7, BOUND_EXACT, PARIS);
+    assert(ttProbe(table, 0x1234 + 32, &depth, &value, &bound, &move));
+    assert(depth == 2 && value == 7 && bound == BOUND_EXACT && move == PARIS);
+    printf("passed\n");
+
+    printf("Test old searches are replaced\n");
+    ttStore(table, 0x99, 10, 1, BOUND_EXACT, NOWHERE);
+    ttStore(table, 0x99 + 16, 1, 2, BOUND_EXACT, NOWHERE);
+    assert(ttProbe(table, 0x99, &depth, &value, &bound, &move));
+    ttNewSearch(table);
+    assert(ttProbe(table, 0x99, &depth, &value, &bound, &move));
+    ttStore(table, 0x99 + 16, 1, 2, BOUND_EXACT, NOWHERE);
+    assert(!ttProbe(table, 0x99, &depth, &value, &bound, &move));
+    assert(ttProbe(table, 0x99 + 16, &depth, &value, &bound, &move));
+    assert(move == NOWHERE);
+    ttClear(table);
+    assert(!ttProbe(table, 0x99 + 16, &depth, &value, &bound, &move));
+    disposeTransTable(table);
+    printf("passed\n");
+
+    printf("Test threads sharing a table never see half-written entries\n");
+    shared = newTransTable(10);
+    pthread_t threads[STRESS_THREADS];
+    int t;
+    for (t = 0; t < STRESS_THREADS; t++){
+        pthread_create(&threads[t], NULL, stress, (void *)(uintptr_t)(t + 1));
+    }
+    for (t = 0; t < STRESS_THREADS; t++){
+        pthread_join(threads[t], NULL);
+    }
+    disposeTransTable(shared);
+    printf("passed\n");
+    return EXIT_SUCCESS;
+}